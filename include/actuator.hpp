@@ -0,0 +1,17 @@
+// actuator.hpp
+#pragma once
+
+// 조향/스로틀 출력 백엔드 공통 인터페이스
+// - 값 범위는 piracer 의 set_steering_percent / set_throttle_percent 와 같음 (-1.0 ~ 1.0)
+// - ACTUATOR_BACKEND 로 선택: "python"(piracer), "pca9685"(I2C 직접), "fake"(가짜 I2C 장치)
+class Actuator {
+public:
+    virtual ~Actuator() = default;
+
+    virtual bool open() = 0;
+    // 조향과 스로틀을 한 번에 출력
+    virtual bool set(float steering, float throttle) = 0;
+    // 종료 시 모터 정지 (0, 0) 출력, 실제로 출력됐는지 반환 (이후 set 호출 없음)
+    virtual bool stop() { return set(0.0f, 0.0f); }
+    virtual const char* name() const = 0;
+};
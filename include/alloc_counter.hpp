@@ -0,0 +1,11 @@
+// alloc_counter.hpp
+#pragma once
+
+#include <cstddef>
+
+// 프로세스 전체 힙 할당 횟수 집계 (벤치마크 검증용)
+// - make ALLOC_COUNT=1 로 빌드하면 malloc 계열을 가로채 호출 횟수를 셈
+//   (operator new 와 cv::Mat 버퍼 모두 malloc 계열을 거치므로 함께 집계됨)
+// - 일반 빌드에서는 집계하지 않으며 allocCount() 는 항상 0
+bool allocCountEnabled();
+size_t allocCount();
@@ -0,0 +1,52 @@
+// async_actuator.hpp
+#pragma once
+
+#include "actuator.hpp"
+#include "latency_stats.hpp"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// 다른 Actuator 를 전용 스레드("actuator")에서 구동하는 래퍼
+// - set() 은 최신 명령 한 칸(mailbox)에 저장만 하고 바로 반환 (제어 스레드가 GIL/파이썬 호출을 기다리지 않음)
+// - 작업 스레드는 항상 가장 최신 명령만 꺼내 출력 (밀린 명령은 덮어씀)
+// - 직전 출력과 조향/스로틀 차이가 모두 epsilon 이하이면 출력 생략
+// - 소멸 시 남은 명령(종료 정지 명령 포함)을 출력한 뒤 스레드 종료, 지연 통계 출력
+//   명령 대기: set() -> 작업 스레드가 꺼낼 때까지, 출력: 내부 set() 호출 시간
+// - stop() 은 정지 명령을 넣고 작업 스레드가 끝날 때까지 기다린 뒤 내부 set() 의 실제 결과 반환
+class AsyncActuator : public Actuator {
+public:
+    AsyncActuator(std::unique_ptr<Actuator> inner, float epsilon);
+    ~AsyncActuator() override;
+
+    bool open() override;
+    bool set(float steering, float throttle) override;
+    bool stop() override;
+    const char* name() const override { return inner_->name(); }
+
+private:
+    void workerLoop();
+
+    std::unique_ptr<Actuator> inner_;
+    const float epsilon_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool pending_ = false;
+    bool stop_ = false;
+    float steering_ = 0.0f;
+    float throttle_ = 0.0f;
+    int64_t command_ns_ = 0;  // 저장 시각
+
+    // 작업 스레드 전용
+    bool sent_ = false;
+    float sent_steering_ = 0.0f;
+    float sent_throttle_ = 0.0f;
+    size_t coalesced_ = 0;
+    bool last_delivered_ = false;  // 종료 직전 명령의 출력 성공 여부 (join 뒤에 읽음)
+    LatencyStats wait_latency_;
+    LatencyStats dispatch_latency_;
+
+    std::thread thread_;
+};
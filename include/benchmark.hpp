@@ -0,0 +1,12 @@
+// benchmark.hpp
+#pragma once
+#include <string>
+
+// 녹화 영상(없으면 합성 프레임)으로 인식 단계별 프레임당 처리 시간 측정
+// + 하드웨어 없이 액추에이터/게임패드 경로 자체 점검 (실패하면 1 반환)
+// 실행: ./auto_drive b [영상 경로]
+int runBenchmark(const std::string& video_path);
+
+// 카메라 백엔드별(gstreamer / v4l2 / file) 캡처 지연과 CPU 사용량 측정
+// 실행: ./auto_drive c [백엔드당 측정 시간(초)]
+int runCameraBenchmark(double seconds);
@@ -0,0 +1,35 @@
+// birdseye_view.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+// 차선 마스크 전용 역원근(bird's-eye) 변환
+// - constants.json 의 IPM_SRC_POINTS (정규화 좌표, 좌상/우상/우하/좌하) 사다리꼴을
+//   [IPM_DST_X1, IPM_DST_X2] 폭의 직사각형으로 펼침
+// - 고정소수점(CV_16SC2) remap 테이블을 시작 시/설정 변경 시에만 생성
+// - BGR 프레임이 아닌 0/255 마스크만 최근접 보간으로 변환
+// - ROI_REMOVE_LEFT 적용/미적용 테이블을 함께 만들어 두어 주행 중 전환 비용 없음
+class BirdseyeView {
+public:
+    BirdseyeView();
+
+    // 크기나 보정값이 바뀌었으면 테이블 재생성, 재생성했으면 true
+    bool rebuildIfNeeded(cv::Size size);
+
+    // 마스크를 bird's-eye 좌표로 변환 (remove_left: 원본 x <= ROI_REMOVE_LEFT_X_THRESHOLD 제외)
+    // 테이블이 없으면 (IPM_SRC_POINTS 오류) 차선이 없는 빈 마스크 출력
+    void warp(const cv::Mat& mask, cv::Mat& out, bool remove_left) const;
+
+private:
+    void buildMaps(cv::Size size);
+
+    cv::Mat map_;            // 전체 영역 테이블
+    cv::Mat map_cut_left_;   // 좌측 제거 테이블
+    cv::Size size_;
+    std::vector<float> src_points_;
+    float dst_x1_ = 0.0f;
+    float dst_x2_ = 0.0f;
+    int cut_threshold_ = -1;
+    bool invalid_warned_ = false;
+};
@@ -0,0 +1,37 @@
+// checkerboard_detector.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+// 클래스 이미지(0 / 127 / 255)에서 체크무늬(출발선)를 찾는 run-length 기반 검출기
+// - 각 행/열에서 길이가 [CHECKER_MIN_RUN, CHECKER_MAX_RUN] 인 전경/배경 run이
+//   연속으로 CHECKER_MIN_ALTERNATIONS 개 이상 이어지면 "체크 라인"으로 판정
+// - 체크 라인이 행과 열 모두 CHECKER_MIN_LINES 개 이상이면 출발선으로 판단
+//   (횡단보도처럼 한 방향으로만 반복되는 무늬는 열 조건에서 걸러짐)
+// - 열 방향도 행 순서로 훑으며 열별 상태를 누적하므로 메모리 접근이 연속적
+class CheckerboardDetector {
+public:
+    CheckerboardDetector();
+
+    // roi 분석 후 체크무늬 여부 반환
+    bool detect(const cv::Mat& roi);
+
+    // 마지막 detect() 결과의 체크 라인 수
+    int checkerRows() const { return checker_rows_; }
+    int checkerCols() const { return checker_cols_; }
+
+private:
+    bool isRegularRun(int length) const;
+
+    // 열별 run 상태 (행 순회 중 누적)
+    std::vector<uchar> col_prev_;
+    std::vector<int> col_run_;
+    std::vector<int> col_chain_;
+    std::vector<int> col_best_;
+
+    int checker_rows_ = 0;
+    int checker_cols_ = 0;
+    int min_run_ = 0;   // detect() 동안 고정한 CHECKER_MIN_RUN / CHECKER_MAX_RUN
+    int max_run_ = 0;
+};
@@ -0,0 +1,52 @@
+// color_classifier.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+// BGR 픽셀을 HSV 변환 없이 {없음, 흰색, 노란색} 으로 바로 분류하는 LUT 분류기
+// - 채널당 상위 5비트로 양자화한 32x32x32 테이블 (32KB, L1 캐시에 들어감)
+// - 셀 안의 512개 색이 모두 같은 클래스면 테이블 값으로 바로 결정
+// - 임계값 경계에 걸친 셀(CLASS_MIXED)만 OpenCV와 동일한 정수 HSV 식으로 정확히 계산
+class ColorClassifier {
+public:
+    static constexpr uchar CLASS_NONE = 0;
+    static constexpr uchar CLASS_YELLOW = 127;
+    static constexpr uchar CLASS_WHITE = 255;
+
+    ColorClassifier();
+
+    // 임계값 상수가 바뀌었으면 테이블 재생성
+    void updateIfNeeded();
+
+    // 한 번의 순회로 클래스 이미지(0/127/255)와 흰색/노란색 마스크(0/255) 생성
+    void classify(const cv::Mat& bgr, const cv::Mat& roi_mask,
+                  cv::Mat& grayscale, cv::Mat& white_mask, cv::Mat& yellow_mask);
+
+    // Bayer 원본에서 2x2 쿼드 하나를 픽셀 하나로 보고 디모자이크 + 축소 + 분류를 한 번에 수행
+    // - 출력 크기는 roi_mask 크기, 쿼드 격자에서 최근접으로 샘플링
+    // - (red_x, red_y): 쿼드 안 R 위치, B 는 대각선 반대, G 두 개는 평균
+    // - 시각화/녹화용 BGR 프레임도 같은 순회에서 함께 기록
+    // - rows 밖의 출력 행은 건드리지 않음 (캡처 단계 ROI 자르기)
+    void classifyBayer(const cv::Mat& bayer, int red_x, int red_y, const cv::Mat& roi_mask, cv::Range rows,
+                       cv::Mat& bgr, cv::Mat& grayscale, cv::Mat& white_mask, cv::Mat& yellow_mask);
+
+    // 단일 픽셀 정확 분류 (cv::COLOR_BGR2HSV 8비트 결과와 동일한 기준)
+    uchar classifyPixel(int b, int g, int r) const;
+
+private:
+    static constexpr int QUANT_SHIFT = 3;               // 8비트 -> 5비트
+    static constexpr int QUANT_BITS = 8 - QUANT_SHIFT;
+    static constexpr uchar CLASS_MIXED = 1;             // 정확 계산이 필요한 셀
+
+    void buildTable();
+
+    std::vector<uchar> lut_;
+    std::vector<int> quad_cols_;   // 출력 x -> 쿼드 시작 열 (Bayer 경로)
+    int quad_src_cols_ = -1;
+    int white_s_max_ = -1;
+    int white_v_min_ = -1;
+    int valid_v_min_ = -1;
+    int yellow_h_min_ = -1;
+    int yellow_h_max_ = -1;
+};
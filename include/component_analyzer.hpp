@@ -0,0 +1,48 @@
+// component_analyzer.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+// 연결 요소 하나의 통계
+struct ComponentStats {
+    int area = 0;             // 픽셀 수
+    int left = 0, top = 0;    // 외접 사각형 (양 끝 포함)
+    int right = 0, bottom = 0;
+    int max_transitions = 0;  // 요소 마스크 기준 한 행의 최대 0↔1 전이 횟수
+
+    cv::Rect rect() const { return cv::Rect(left, top, right - left + 1, bottom - top + 1); }
+};
+
+// 행 단위 run 기반 8-연결 요소 분석기
+// - 픽셀은 한 번만 순회하며 run 추출과 동시에 윗행 run과 union-find로 병합
+// - 이후 run 목록만 훑어 면적/외접 사각형/행별 전이 횟수를 함께 집계
+// - 요소 순서는 래스터 순서 첫 픽셀 기준 (cv::connectedComponents 라벨 순서와 동일)
+// - 내부 버퍼는 재사용되므로 반환된 참조는 다음 analyze() 호출 전까지만 유효
+class ComponentAnalyzer {
+public:
+    ComponentAnalyzer();
+
+    // rows x cols 영역 최악의 경우(행마다 한 칸 건너 run)에 맞춰 내부 버퍼 확보
+    void reserve(int rows, int cols);
+
+    // roi 에서 값이 min_value 이상인 픽셀을 전경으로 보고 분석
+    const std::vector<ComponentStats>& analyze(const cv::Mat& roi, uchar min_value);
+
+private:
+    struct Run {
+        int row;
+        int start;
+        int end;   // 포함
+    };
+
+    int findRoot(int label);
+    void unite(int a, int b);
+
+    std::vector<Run> runs_;
+    std::vector<int> parent_;          // run 인덱스 기준 union-find
+    std::vector<int> component_of_;    // 루트 run -> 요소 인덱스
+    std::vector<int> row_transitions_; // 현재 집계 중인 행의 요소별 전이 횟수
+    std::vector<int> last_row_;        // 요소별 마지막으로 집계한 행
+    std::vector<ComponentStats> stats_;
+};
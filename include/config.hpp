@@ -0,0 +1,98 @@
+// config.hpp
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// 실행 중 바꿀 수 있는 튜닝 값 묶음 (constants.json 의 같은 이름 항목)
+// - 한 번 만든 Config 는 수정하지 않고, 새 값은 새 Config 를 만들어 원자적으로 교체
+// - 각 단계는 프레임(제어 주기)마다 pinConfig() 로 최신 Config 를 고정해 읽음
+//   -> 한 프레임 처리 중에는 값이 바뀌지 않고, 읽는 쪽과 교체하는 쪽 사이 경쟁 없음
+// - 카메라/기하/스레드/백엔드 설정처럼 시작 시 구조를 정하는 값은 constants.hpp 전역 (재시작 필요)
+struct Config {
+    uint64_t version = 0;  // publishConfig() 가 매김 (1 부터)
+
+    // 색 분류
+    int WHITE_S_MAX = 0;
+    int WHITE_V_MIN = 0;
+    int VALID_V_MIN = 0;
+    int YELLOW_H_MIN = 0;
+    int YELLOW_H_MAX = 0;
+
+    // 차선 검출
+    int ROI_REMOVE_LEFT_X_THRESHOLD = 0;
+    int DEFAULT_LANE_GAP = 0;
+    float AVG_PARAM = 0.0f;
+    float INTER_PARAM = 0.0f;
+    int LANE_TRACK_WINDOW = 0;
+    int LANE_TRACK_MAX_MISSES = 0;
+    int YELLOW_PIXEL_THRESHOLD = 0;
+
+    // 객체 검출 판정 기준 (ROI 위치는 캡처 자르기에 쓰이므로 전역)
+    float STOPLINE_DETECTION_THRESHOLD = 0.0f;
+    int CROSSWALK_DETECTION_RECT_HEIGHT_THRESHOLD = 0;
+    int CROSSWALK_DETECTION_RECT_WIDTH_THRESHOLD = 0;
+    int CROSSWALK_DETECTION_RECT_COUNT_THRESHOLD = 0;
+    int STARTLINE_DETECTION_THRESHOLD = 0;
+    float GFT_CORNER_QUALITY_LEVEL = 0.0f;
+    int GFT_MIN_CORNER_DISTANCE = 0;
+    int CHECKER_MIN_RUN = 0;
+    int CHECKER_MAX_RUN = 0;
+    int CHECKER_MIN_ALTERNATIONS = 0;
+    int CHECKER_MIN_LINES = 0;
+
+    // 주행 제어
+    int WAIT_SECONDS = 0;
+    bool ROI_REMOVE_LEFT = false;   // 시작 시 주행 모드 (이후는 제어기 상태)
+    bool WHITE_LINE_DRIVE = true;
+    float STEERING_OFFSET = 0.0f;
+    float STEERING_OFFSET_2 = 0.0f;
+    float STEERING_KP = 0.0f;
+    float STEERING_KI = 0.0f;
+    float STEERING_KD = 0.0f;
+    float STEERING_I_LIMIT = 0.0f;
+    float STEERING_D_FILTER = 0.0f;
+    float STEERING_KFF_HEADING = 0.0f;
+    float STEERING_KFF_CURVATURE = 0.0f;
+    bool STEERING_LATENCY_COMP = false;
+    int STEERING_ACTUATION_DELAY_MS = 0;
+    int STEERING_LATENCY_MAX_MS = 0;
+    float THROTTLE_KP = 0.0f;
+    float MAX_THROTTLE = 0.0f;
+    float BASE_THROTTLE = 0.0f;
+    bool THROTTLE_SCHEDULING = false;
+    float THROTTLE_HEADING_GAIN = 0.0f;
+    float THROTTLE_CURVATURE_GAIN = 0.0f;
+    bool ADAPTIVE_DETECTORS = true;
+    int DETECTOR_IDLE_DECIMATION = 0;
+};
+
+using ConfigPtr = std::shared_ptr<const Config>;
+
+// 가장 최근에 게시된 Config (아직 없으면 nullptr)
+ConfigPtr currentConfig();
+// 새 Config 게시 (version 을 매겨 원자적으로 교체), 게시한 version 반환
+uint64_t publishConfig(std::shared_ptr<Config> config);
+
+// constants.json 을 다시 읽어 튜닝 값만 새 Config 로 게시 (실패하면 기존 값 유지하고 false)
+bool reloadConfig(const std::string& path);
+
+// 호출한 스레드가 고정한 Config (고정한 적 없으면 최신 Config 를 고정)
+const Config& config();
+// 호출한 스레드에 최신 Config 고정 (단계 루프에서 프레임마다 호출)
+const Config& pinConfig();
+
+// 작업 실행 동안 호출 스레드의 Config 를 지정한 것으로 바꿈 (작업 그래프의 프레임 Config 공유용)
+// - config 는 ConfigScope 보다 오래 살아 있어야 함
+class ConfigScope {
+public:
+    explicit ConfigScope(const Config& config);
+    ~ConfigScope();
+
+    ConfigScope(const ConfigScope&) = delete;
+    ConfigScope& operator=(const ConfigScope&) = delete;
+
+private:
+    const Config* previous_;
+};
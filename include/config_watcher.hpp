@@ -0,0 +1,29 @@
+// config_watcher.hpp
+#pragma once
+
+#include <string>
+#include <thread>
+
+// constants.json 변경 감지 후 튜닝 값 재적용 (inotify)
+// - 편집기가 임시 파일을 쓴 뒤 rename 하는 경우도 잡도록 파일이 아닌 디렉터리를 감시
+//   (IN_CLOSE_WRITE / IN_MOVED_TO 중 파일 이름이 같은 것)
+// - 변경되면 reloadConfig() 로 새 Config 게시, 각 단계는 다음 프레임부터 새 값 사용
+// - 시작 시 구조를 정하는 전역 설정(constants.hpp)은 다시 읽지 않음
+class ConfigWatcher {
+public:
+    explicit ConfigWatcher(const std::string& path);
+    ~ConfigWatcher();
+
+    bool start();
+    void stop();
+
+private:
+    void run();
+
+    std::string path_;
+    std::string directory_;
+    std::string filename_;
+    int inotify_fd_ = -1;
+    int wake_fd_ = -1;
+    std::thread thread_;
+};
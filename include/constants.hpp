@@ -1,22 +1,14 @@
 #pragma once
+#include <map>
 #include <string>
+#include <vector>
 
 // 전역 변수 선언
 extern int FRAME_WIDTH;
 extern int FRAME_HEIGHT;
 extern int ROI_Y_START;
 extern int ROI_Y_END;
-extern int WHITE_S_MAX;
-extern int WHITE_V_MIN;
-extern int VALID_V_MIN;
-extern int YELLOW_H_MIN;
-extern int YELLOW_H_MAX;
 extern bool VIEWER;
-extern float STEERING_KP;
-extern float THROTTLE_KP;
-extern float MAX_THROTTLE;
-extern float BASE_THROTTLE;
-extern int WAIT_SECONDS;
 extern int RED_H_MIN1;
 extern int RED_H_MIN2;
 extern int RED_H_MAX1;
@@ -26,33 +18,58 @@ extern int RED_V_MIN;
 extern int Y_TOP;
 extern int LONG_HALF;
 extern int SHORT_HALF;
-extern bool ROI_REMOVE_LEFT;
-extern int ROI_REMOVE_LEFT_X_THRESHOLD;
-extern bool WHITE_LINE_DRIVE;
-extern int YELLOW_PIXEL_THRESHOLD;
-extern int DEFAULT_LANE_GAP;
 extern float STOPLINE_DETECTION_Y1;
 extern float STOPLINE_DETECTION_Y2;
-extern float STOPLINE_DETECTION_THRESHOLD;
-extern float AVG_PARAM;
-extern float INTER_PARAM;
 extern float CROSSWALK_DETECTION_X1;
 extern float CROSSWALK_DETECTION_X2;
 extern float CROSSWALK_DETECTION_Y1;
 extern float CROSSWALK_DETECTION_Y2;
-extern int CROSSWALK_DETECTION_RECT_HEIGHT_THRESHOLD;
-extern int CROSSWALK_DETECTION_RECT_WIDTH_THRESHOLD;
-extern int CROSSWALK_DETECTION_RECT_COUNT_THRESHOLD;
 extern float STARTLINE_DETECTION_X1;
 extern float STARTLINE_DETECTION_X2;
 extern float STARTLINE_DETECTION_Y1;
 extern float STARTLINE_DETECTION_Y2;
-extern int STARTLINE_DETECTION_THRESHOLD;
 extern int GFT_MAX_CORNER_QUANTITY;
-extern float GFT_CORNER_QUALITY_LEVEL;
-extern int GFT_MIN_CORNER_DISTANCE;
-extern float STEERING_OFFSET;
-extern float STEERING_OFFSET_2;
+extern std::string COLOR_CLASSIFIER;
+extern std::string STARTLINE_DETECTOR;
+extern bool LANE_TRACKING;
+extern std::string LANE_MODEL;
+extern int LANE_FIT_ROWS;
+extern int LANE_FIT_ORDER;
+extern float LANE_FIT_Y1;
+extern float LANE_FIT_Y2;
+extern bool IPM_ENABLE;
+extern std::vector<float> IPM_SRC_POINTS;
+extern float IPM_DST_X1;
+extern float IPM_DST_X2;
+extern int IPM_LANE_GAP;
+extern std::string CAMERA_BACKEND;
+extern std::string CAMERA_DEVICE;
+extern int CAMERA_CAPTURE_WIDTH;
+extern int CAMERA_CAPTURE_HEIGHT;
+extern std::string CAMERA_PIXEL_FORMAT;
+extern int CAMERA_BUFFER_COUNT;
+extern int CAMERA_FPS;
+extern std::string CAMERA_FAKE_FILE;
+extern std::string PERCEPTION_INPUT;
+extern std::string CAPTURE_CROP;
+extern int PIPELINE_POLL_MS;
+extern std::string JOIN_POLICY;
+extern int JOIN_TIMEOUT_MS;
+extern std::map<std::string, std::vector<int>> THREAD_PROFILE;
+extern bool MEMORY_LOCK;
+extern int PREFAULT_HEAP_MB;
+extern int EXECUTOR_WORKERS;
+extern std::string ACTUATOR_BACKEND;
+extern std::string ACTUATOR_I2C_DEVICE;
+extern int ACTUATOR_I2C_ADDRESS;
+extern std::string GAMEPAD_BACKEND;
+extern std::string GAMEPAD_DEVICE;
+extern bool ACTUATOR_ASYNC;
+extern float ACTUATOR_EPSILON;
+extern int CONTROL_RATE_HZ;
+extern int CONTROL_EXTRAPOLATE_MAX_MS;
+extern bool CONFIG_HOT_RELOAD;
+extern std::string LANE_KERNEL;
 
 // 초기화 함수 선언
 void load_constants(const std::string& path = "../constants.json");
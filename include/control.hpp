@@ -5,7 +5,12 @@
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <pybind11/embed.h>
+#include "perception_result.hpp"
+#include "steering_controller.hpp"
+#include "actuator.hpp"
+#include "evdev_gamepad.hpp"
 
 enum class DriveState {
     DRIVE,
@@ -19,21 +24,40 @@ public:
     Controller();
     ~Controller();
 
-    void update(bool stop_line, bool crosswalk, bool start_line, int cross_offset, int yellow_pixel_count);
+    // 한 프레임 기준으로 합류된 인식 결과로 주행 제어 수행
+    void update(const PerceptionSnapshot& snapshot);
+
+    // 현재 주행 상태에서 결과를 쓰는 검출기만 매 프레임 실행하도록 한 스케줄
+    // (ADAPTIVE_DETECTORS 가 false 면 모두 매 프레임)
+    DetectorSchedule detectorSchedule() const;
 
 private:
     // ── 기존 멤버 ──
+    // 주행 상태 머신은 제어 스레드(update(), detectorSchedule())만 읽고 씀
+    // 게임패드 스레드는 atomic 멤버(manual_*, reset_requested_)와 last_manual_mode_ 만 사용
     DriveState drive_state_;
     std::chrono::steady_clock::time_point wait_start_time_;
     float steering_;
     float throttle_;
-    bool last_manual_mode_;
+    bool last_manual_mode_;  // 게임패드 스레드 전용
+
+    bool crosswalk_flag_ = false;             // 횡단보도 감지 플래그 (한 번만 처리)
+    bool crosswalk_ignore_stopline_ = false;  // 횡단보도 후 정지선 무시 여부
+    std::chrono::steady_clock::time_point crosswalk_resume_time_;  // 정지선 무시 기간 시작 시간
+
+    // 차선 검출 주행 모드 (detectorSchedule() 로 인식 단계에 전달)
+    bool roi_remove_left_;
+    bool white_line_drive_;
+    bool use_steering_offset_2_ = false;  // 정지선 이후 STEERING_OFFSET_2 사용
+    std::atomic<bool> reset_requested_{false};  // 게임패드 스레드 -> update() 상태 초기화 요청
 
-    float computeSteering(int offset) const;
-    float computeThrottle(int offset) const;
+    SteeringController steering_law_;  // PID + 피드포워드 조향, 곡률 기반 스로틀
+    float computeSteering(const LaneResult& lane);
+    float computeThrottle(const LaneResult& lane) const;
 
     struct Impl;
     Impl* impl_;
+    std::unique_ptr<Actuator> actuator_;  // 조향/스로틀 출력 (ACTUATOR_BACKEND)
 
     // ── 추가할 멤버 ──
     std::atomic<bool>   manual_mode_{false};
@@ -42,7 +66,9 @@ private:
 
     std::atomic<bool>   gamepad_running_{false};
     std::thread         gamepad_thread_;
+    std::unique_ptr<EvdevGamepad> evdev_gamepad_;  // 없으면 ShanWanGamepad(python) 사용
     void startGamepadThread();
+    void applyGamepad(const GamepadState& pad);
 };
 
 #endif // CONTROL_HPP
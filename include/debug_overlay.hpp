@@ -0,0 +1,48 @@
+// debug_overlay.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+// 검출기가 남기는 디버그 그리기 명령 목록
+// - 검출기는 원/사각형/텍스트 명령만 기록 (픽셀 복사, 문자열 생성 없음)
+// - 실제 그리기는 뷰어처럼 결과 이미지가 필요한 쪽에서 render() 호출 시에만 수행
+// - 배경 이미지는 헤더만 보관하므로 다음 process() 호출 전까지만 유효
+class DebugOverlay {
+public:
+    DebugOverlay();
+
+    // 새 프레임 시작: 명령 목록 비우고 배경 지정 (BGR 또는 8비트 단일 채널)
+    void reset(const cv::Mat& background);
+
+    void circle(cv::Point center, int radius, const cv::Scalar& color, int thickness);
+    void rectangle(const cv::Rect& rect, const cv::Scalar& color, int thickness);
+    // label 은 문자열 리터럴처럼 render() 시점까지 유효한 문자열이어야 함
+    void text(const char* label, cv::Point org, double scale, const cv::Scalar& color, int thickness);
+    // label 뒤에 value 를 붙여 표시 (std::to_string 과 같은 형식)
+    void text(const char* label, float value, cv::Point org, double scale, const cv::Scalar& color, int thickness);
+
+    // other 의 명령을 뒤에 덧붙임 (배경은 그대로, 병렬 작업의 오버레이 합치기용)
+    void append(const DebugOverlay& other);
+
+    // 배경 위에 기록된 명령을 그려 BGR 이미지로 출력 (out 버퍼 재사용)
+    void render(cv::Mat& out) const;
+
+private:
+    enum class Type { CIRCLE, RECTANGLE, TEXT, TEXT_VALUE };
+
+    struct Command {
+        Type type;
+        cv::Point point;    // 원 중심 / 텍스트 위치
+        cv::Rect rect;
+        int radius;
+        double scale;
+        cv::Scalar color;
+        int thickness;
+        const char* label;
+        float value;
+    };
+
+    cv::Mat background_;
+    std::vector<Command> commands_;
+};
@@ -0,0 +1,72 @@
+// evdev_gamepad.hpp
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+struct input_event;  // <linux/input.h>
+
+// 게임패드 입력 한 번(SYN_REPORT 단위)의 상태
+// - 축 값은 -1.0 ~ 1.0 (piracer ShanWanGamepad.read_data() 와 같은 부호: 스틱을 위로 밀면 y > 0)
+struct GamepadState {
+    float left_x = 0.0f;
+    float left_y = 0.0f;
+    float right_x = 0.0f;
+    float right_y = 0.0f;
+    bool button_a = false;
+    bool button_b = false;
+};
+
+// /dev/input/event* 를 직접 읽는 게임패드 입력 (파이썬/GIL 사용 없음)
+// - ShanWan 배치: 왼쪽 스틱 ABS_X/ABS_Y, 오른쪽 스틱 ABS_Z/ABS_RZ, A = BTN_A, B = BTN_B
+// - 축 범위는 EVIOCGABS 로 읽고, 읽을 수 없으면(FIFO 등 가짜 장치) 0 ~ 255 로 가정
+// - waitReport() 는 poll 로 블로킹, stop() 은 eventfd 로 대기 중인 waitReport() 를 깨움
+// - device 가 FIFO 면 가짜 장치로 사용 (struct input_event 를 그대로 써 넣으면 됨)
+// - device 가 "auto" 면 BTN_A 와 ABS_RZ 를 모두 가진 첫 event 장치를 사용
+// - 장치가 분리되면 reconnect() 로 다시 열 때까지 재시도 (재연결 시 "auto" 는 다시 검색)
+class EvdevGamepad {
+public:
+    explicit EvdevGamepad(const std::string& device);
+    ~EvdevGamepad();
+
+    bool open();
+    // 다음 SYN_REPORT 까지 이벤트를 반영한 state 를 돌려줌 (stop() 또는 장치 분리/오류면 false)
+    bool waitReport(GamepadState& state);
+    // 장치를 다시 열 때까지 간격을 늘려 가며 재시도 (RECONNECT_MIN_MS ~ RECONNECT_MAX_MS)
+    // 다시 열면 true (입력 상태는 중립으로 초기화), stop() 이면 false
+    bool reconnect();
+    // 다른 스레드에서 호출 가능
+    void stop();
+
+    const std::string& device() const { return device_; }
+
+    static constexpr int RECONNECT_MIN_MS = 100;
+    static constexpr int RECONNECT_MAX_MS = 2000;
+
+private:
+    struct AxisRange {
+        int min = 0;
+        int max = 255;
+    };
+
+    static std::string findDevice();
+    bool openDevice(bool verbose);
+    void closeDevice();
+    void readAxisRange(int code, AxisRange& range);
+    static float normalize(int value, const AxisRange& range);
+
+    std::string requested_;  // 설정 값 ("auto" 또는 경로)
+    std::string device_;     // 실제로 연 장치
+    int fd_ = -1;
+    int fifo_keepalive_fd_ = -1;
+    int wake_fd_ = -1;
+    GamepadState state_;
+
+    // read() 한 번에 받은 이벤트 (다음 SYN_REPORT 이후 남은 이벤트는 다음 waitReport() 에서 반영)
+    static constexpr size_t PENDING_EVENTS = 16;
+    std::unique_ptr<input_event[]> pending_;
+    size_t pending_count_ = 0;
+    size_t pending_next_ = 0;
+    AxisRange x_, y_, z_, rz_;
+};
@@ -0,0 +1,48 @@
+// file_capture.hpp
+#pragma once
+
+#include "frame_source.hpp"
+#include <chrono>
+#include <fstream>
+#include <vector>
+
+// 원본 프레임 덤프 파일을 카메라처럼 재생하는 가짜 장치 (테스트/벤치마크용)
+// - 파일은 width x height, fourcc 형식 프레임을 이어 붙인 raw 데이터 (끝나면 처음부터 반복)
+// - fps 주기로 프레임이 "도착"한 것으로 보고, 늦게 읽으면 밀린 프레임을 건너뜀
+// - V4L2 백엔드와 같이 고정 버퍼 링과 hold 참조로 버퍼 재사용 규칙을 그대로 따름
+class FileCapture : public FrameSource {
+public:
+    FileCapture(const std::string& path, int width, int height, uint32_t fourcc, int buffer_count, int fps);
+
+    bool open() override;
+    bool read(CapturedFrame& out) override;
+    const char* name() const override { return "file"; }
+
+private:
+    struct Buffer {
+        cv::Mat image;
+        std::shared_ptr<int> token;
+    };
+
+    bool readFrame(cv::Mat& dst);
+    Buffer* findReleasedBuffer();
+    Buffer* waitForReleasedBuffer();
+
+    std::string path_;
+    int width_;
+    int height_;
+    uint32_t fourcc_;
+    int buffer_count_;
+    std::chrono::nanoseconds period_;
+
+    std::ifstream file_;
+    size_t frame_bytes_ = 0;
+    long frame_count_ = 0;
+    std::vector<Buffer> buffers_;
+    std::chrono::steady_clock::time_point start_;
+    uint32_t next_sequence_ = 0;
+
+    // 모든 버퍼가 하류에 잡혀 있던 횟수 (경고를 초당 1번으로 묶어서 출력)
+    int64_t last_held_warn_ns_ = 0;
+    int held_waits_ = 0;
+};
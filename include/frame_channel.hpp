@@ -0,0 +1,86 @@
+// frame_channel.hpp
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "frame_preprocessor.hpp"
+
+// 카메라 스레드(단일 생산자) -> 검출 스레드들(다중 소비자) 최신 프레임 전달 채널
+// - 슬롯(PreprocessedFrame)을 시작 시 미리 할당해 두고 돌려 쓰므로 프레임당 힙 할당 없음
+// - 게시할 때마다 1부터 단조 증가하는 프레임 ID 부여, 소비자는 ID 로 새 프레임 여부 판단
+// - 최신 슬롯 선택/참조 획득은 원자 연산만 사용 (잠금 없음)
+//   잠든 소비자가 있을 때만 뮤텍스를 잡고 깨움
+// - 소비자가 모두 잡고 있어 쓸 슬롯이 없으면 그 프레임은 버리고 dropped() 증가
+//   슬롯 수는 (소비자 수 + 2) 이상이면 정상 상태에서 버리는 프레임 없음
+class FrameChannel {
+    struct Slot {
+        PreprocessedFrame frame;
+        std::atomic<uint32_t> refs{0}; // 읽는 소비자 수 + 생산자 기록 중 플래그
+        std::atomic<uint64_t> id{0};   // 이 슬롯에 마지막으로 게시된 프레임 ID
+    };
+
+public:
+    // 소비자가 잡고 있는 슬롯 참조 (소멸 시 반환, 이동만 가능)
+    class Ref {
+    public:
+        Ref() = default;
+        ~Ref() { reset(); }
+        Ref(Ref&& other) noexcept;
+        Ref& operator=(Ref&& other) noexcept;
+        Ref(const Ref&) = delete;
+        Ref& operator=(const Ref&) = delete;
+
+        void reset();
+        explicit operator bool() const { return slot_ != nullptr; }
+        const PreprocessedFrame& operator*() const { return slot_->frame; }
+        const PreprocessedFrame* operator->() const { return &slot_->frame; }
+        uint64_t id() const { return id_; } // 0: 비어 있음
+
+    private:
+        friend class FrameChannel;
+        Slot* slot_ = nullptr;
+        uint64_t id_ = 0;
+    };
+
+    explicit FrameChannel(int slot_count);
+
+    // 생산자: 기록할 슬롯 확보 (없으면 nullptr), 반드시 publish() 로 마무리
+    PreprocessedFrame* beginWrite();
+    // 생산자: beginWrite() 로 받은 슬롯을 새 ID 로 게시, 게시한 ID 반환
+    uint64_t publish();
+
+    // 최신 프레임 참조 (게시된 프레임이 없으면 false)
+    bool latest(Ref& ref);
+    // last_id 보다 새 프레임이 게시될 때까지 대기 (시간 초과/닫힘이면 false)
+    bool waitNext(uint64_t last_id, Ref& ref, std::chrono::milliseconds timeout);
+
+    // 대기 중인 소비자를 모두 깨우고 이후 대기는 즉시 반환
+    void close();
+
+    uint64_t published() const { return latest_.load(std::memory_order_acquire) >> SLOT_BITS; }
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr uint32_t WRITER = 1u << 31; // refs 의 생산자 기록 중 플래그
+    static constexpr int SLOT_BITS = 8;          // latest_ 하위 비트: 슬롯 번호
+    static constexpr uint64_t SLOT_MASK = (1u << SLOT_BITS) - 1;
+
+    std::unique_ptr<Slot[]> slots_;
+    int slot_count_;
+    int writing_ = -1;   // 생산자가 기록 중인 슬롯 (생산자 스레드 전용)
+    int next_slot_ = 0;  // 다음 탐색 시작 위치 (생산자 스레드 전용)
+    uint64_t next_id_ = 1;
+
+    std::atomic<uint64_t> latest_{0}; // (프레임 ID << SLOT_BITS) | 슬롯 번호, 0: 아직 없음
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> closed_{false};
+
+    // 잠든 소비자 깨우기용 (waiters_ 가 0 이면 생산자는 잠금을 잡지 않음)
+    std::atomic<int> waiters_{0};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+};
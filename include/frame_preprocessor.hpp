@@ -0,0 +1,63 @@
+// frame_preprocessor.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <memory>
+#include <vector>
+#include "color_classifier.hpp"
+#include "frame_source.hpp"
+
+// 프레임 1장에 대한 전처리 결과 묶음 (게시 이후 변경하지 않음)
+struct PreprocessedFrame {
+    cv::Mat frame;        // 원본 BGR 프레임 (시각화용)
+    cv::Mat roi_mask;     // 사다리꼴 관심영역 마스크
+    cv::Mat white_mask;   // 흰색 차선 마스크 (0/255)
+    cv::Mat yellow_mask;  // 노란색 차선 마스크 (0/255)
+    cv::Mat grayscale;    // 클래스 이미지: 흰색=255, 노란색=127, 그 외=0
+    cv::Range classified_rows = cv::Range::all();  // 분류한 행 범위 (캡처 ROI, 밖의 행은 모두 0)
+
+    int64_t capture_ns = 0;                 // 커널 캡처 시각 (CLOCK_MONOTONIC, 0: 알 수 없음)
+    uint32_t sequence = 0;                  // 카메라 프레임 번호
+    std::shared_ptr<const void> capture_hold; // frame 이 드라이버 버퍼를 직접 가리킬 때 버퍼 유지
+
+    cv::Mat owned_bgr;    // Bayer 경로에서 frame 이 가리키는 번들 전용 BGR 버퍼
+
+    // FRAME_WIDTH x FRAME_HEIGHT 로 출력 버퍼 미리 할당
+    void allocate();
+    // 재사용 전 카메라 버퍼 참조 해제
+    void releaseCapture();
+};
+
+// 캡처된 프레임마다 한 번만 HSV 변환 및 마스크 계산을 수행하는 전처리 단계
+// - 결과는 호출자가 준 번들(FrameChannel 슬롯 등)에 바로 기록, 버퍼 크기가 같으면 재할당 없음
+// - HSV 경로의 중간 버퍼도 멤버로 보관해 정상 상태에서는 프레임당 할당 없음
+class FramePreprocessor {
+public:
+    FramePreprocessor();
+
+    // 전처리 실행 후 결과를 out 에 기록
+    void process(const cv::Mat& frame, PreprocessedFrame& out);
+    // 캡처 시각/프레임 번호와 드라이버 버퍼 참조까지 번들에 함께 담음
+    // Bayer 형식이면 2x2 쿼드에서 바로 분류 (PERCEPTION_INPUT = "bayer"), frame 은 쿼드로 만든 BGR
+    void process(const CapturedFrame& captured, PreprocessedFrame& out);
+
+    // 검출기가 읽는 행 범위만 분류 (나머지 행은 0), 기본값은 전체 행
+    void setCropRows(cv::Range rows);
+
+private:
+    // 영역 마스크 생성 (프레임 크기가 바뀔 때만 다시 생성)
+    cv::Mat createTrapezoidMask(int height, int width);
+
+    // 기존 HSV 변환 기반 분류 (COLOR_CLASSIFIER = "hsv")
+    void classifyHsv(const cv::Mat& frame, const cv::Mat& roi_mask, cv::Mat& grayscale, cv::Mat& white_mask, cv::Mat& yellow_mask);
+
+    cv::Mat roi_mask_;
+    cv::Range crop_rows_ = cv::Range::all();
+    ColorClassifier classifier_; // COLOR_CLASSIFIER = "lut"
+
+    // HSV 경로 작업 버퍼
+    cv::Mat hsv_;
+    cv::Mat hsv_channels_[3];
+    cv::Mat valid_mask_;
+    cv::Mat scratch_mask_;
+};
@@ -0,0 +1,42 @@
+// frame_source.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// 캡처 백엔드가 넘겨주는 프레임 1장
+// - image 는 장치 원본 형식(fourcc) 그대로이며, 가능하면 드라이버 버퍼를 감싼 헤더 (복사 없음)
+// - hold 가 살아있는 동안 버퍼는 드라이버에 반환되지 않음 (비어 있으면 image 가 자체 메모리 소유)
+struct CapturedFrame {
+    cv::Mat image;
+    uint32_t fourcc = 0;         // V4L2 픽셀 형식 (0: BGR)
+    int64_t timestamp_ns = 0;    // 커널 캡처 시각 (CLOCK_MONOTONIC, 0: 알 수 없음)
+    uint32_t sequence = 0;       // 장치 프레임 번호 (건너뛴 프레임은 번호 간격으로 나타남)
+    std::shared_ptr<const void> hold;
+};
+
+// 카메라 캡처 백엔드 공통 인터페이스
+// - read() 는 항상 가장 최신 프레임을 반환 (밀린 프레임은 버림)
+class FrameSource {
+public:
+    virtual ~FrameSource() = default;
+
+    virtual bool open() = 0;
+    virtual bool read(CapturedFrame& out) = 0;
+    virtual const char* name() const = 0;
+};
+
+// "BA81" 같은 4문자 형식 이름 <-> fourcc 값
+uint32_t fourccFromString(const std::string& name);
+std::string fourccToString(uint32_t fourcc);
+
+// fourcc 형식 한 픽셀의 바이트 수 (지원하지 않는 형식이면 0)
+int bytesPerPixel(uint32_t fourcc);
+
+// 캡처 프레임을 BGR 로 변환 (이미 BGR 이면 헤더만 공유, 지원하지 않는 형식이면 false)
+bool convertToBgr(const CapturedFrame& in, cv::Mat& bgr);
+
+// 8비트 Bayer 형식이면 2x2 쿼드 안 R 위치를 돌려주고 true
+bool bayerRedOffset(uint32_t fourcc, int& red_x, int& red_y);
@@ -0,0 +1,64 @@
+// i2c_bus.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 한 I2C 장치(주소 고정)에 대한 쓰기 전용 버스
+// - write() 한 번이 I2C 트랜잭션 하나 (첫 바이트는 레지스터 주소)
+class I2cBus {
+public:
+    virtual ~I2cBus() = default;
+
+    virtual bool open() = 0;
+    virtual bool write(const uint8_t* data, size_t length) = 0;
+    virtual const char* name() const = 0;
+};
+
+// /dev/i2c-N 장치 파일 + I2C_SLAVE ioctl
+class LinuxI2cBus : public I2cBus {
+public:
+    LinuxI2cBus(const std::string& device, int address);
+    ~LinuxI2cBus() override;
+
+    bool open() override;
+    bool write(const uint8_t* data, size_t length) override;
+    const char* name() const override { return "i2c-dev"; }
+
+private:
+    std::string device_;
+    int address_;
+    int fd_ = -1;
+};
+
+// 레지스터 쓰기를 기록하는 가짜 장치 (하드웨어 없이 출력 확인/테스트용)
+// - 레지스터 주소 자동 증가(PCA9685 MODE1.AI)를 흉내 내 registers() 에 반영
+// - 트랜잭션은 최근 HISTORY 개만 보관 (고정 크기, 쓰기 시 할당 없음)
+class FakeI2cBus : public I2cBus {
+public:
+    static constexpr size_t HISTORY = 64;
+    static constexpr size_t MAX_TRANSACTION = 16;
+
+    struct Transaction {
+        uint8_t bytes[MAX_TRANSACTION] = {};
+        size_t length = 0;
+    };
+
+    FakeI2cBus();
+
+    bool open() override { return true; }
+    bool write(const uint8_t* data, size_t length) override;
+    const char* name() const override { return "fake"; }
+
+    const uint8_t* registers() const { return registers_; }
+    size_t transactionCount() const { return count_; }
+    // 최근 트랜잭션 (0: 가장 최근)
+    const Transaction& recent(size_t age) const;
+
+private:
+    uint8_t registers_[256] = {};
+    std::vector<Transaction> history_;
+    size_t count_ = 0;
+};
@@ -1,21 +1,73 @@
 #pragma once
 #include <opencv2/opencv.hpp>
 #include <vector>
+#include "frame_preprocessor.hpp"
+#include "lane_model.hpp"
+#include "birdseye_view.hpp"
+#include "debug_overlay.hpp"
+#include "lane_kernels.hpp"
 
 class LaneDetector {
 public:
     LaneDetector();
 
-    // 조향각과 감지 플래그 반환
-    int process(const cv::Mat& frame, cv::Mat& vis_out);
+    // 조향각과 감지 플래그 반환 (전처리 번들을 입력으로 사용)
+    // 디버그 표시는 overlay 에 명령으로만 기록 (그리기는 호출자가 필요할 때 render)
+    int process(const PreprocessedFrame& input, DebugOverlay& overlay);
     int getYellowPixelCount() const;
+    // 마지막 process() 의 오프셋/기울기/곡률
+    LaneEstimate getLaneEstimate() const;
+
+    // 제어기 주행 모드 (노란 차선 구간: 좌측 ROI 제거 + 노란 차선 추종), 다음 process() 부터 적용
+    void setDriveMode(bool roi_remove_left, bool white_line_drive) {
+        roi_remove_left_ = roi_remove_left;
+        white_line_drive_ = white_line_drive;
+    }
+
+    // 현재 설정에서 마스크를 읽는 행 범위 (캡처 단계 ROI 자르기용)
+    static cv::Range requiredRows(int height);
 
 private:
-    cv::Mat createTrapezoidMask(int height, int width);
-    std::vector<std::vector<int>> findBlobs(const uchar* row_ptr, int width, int min_blob_size = 10);
+    // 두 행 모드 스캔 커널 선택기 (프레임 크기/주행 모드별 특수화, lane_kernels.hpp)
+    LaneKernelDispatcher lane_kernels_;
+
+    // 추적 모드 (LANE_TRACKING): 직전 위치 ±LANE_TRACK_WINDOW 구간만 탐색
+    bool findBlobNear(const uchar* row_ptr, int width, int x_start, int center, int& x_out, int min_blob_size = 10);
+    bool trackRow(const uchar* row_ptr, int width, int x_start, int row_index, int& x1, int& x2);
+
+    // 샘플 행별 차선 추적 상태
+    struct LaneTrack {
+        bool active = false;
+        int left_x = 0;
+        int right_x = 0;
+        int misses = 0;   // 연속 탐색 실패 횟수
+    };
+    LaneTrack tracks_[2];
+
+    // 다중 행 모델 피팅 모드 (LANE_MODEL = "fit")
+    int processFit(const cv::Mat& mask, int x_start, DebugOverlay& overlay);
+    // 한 행의 run을 고정 버퍼(row_runs_)에 추출, 추출된 개수 반환
+    int extractRuns(const uchar* row_ptr, int width, int x_start, int min_blob_size = 10);
+
+    struct RowRun {
+        int start;
+        int end;   // 포함
+    };
+    static constexpr int MAX_RUNS_PER_ROW = LANE_MAX_RUNS_PER_ROW;
+    RowRun row_runs_[MAX_RUNS_PER_ROW];
+    std::vector<float> left_ts_, left_xs_;    // 피팅용 샘플 (재사용)
+    std::vector<float> right_ts_, right_xs_;
+    LaneEstimate estimate_;
+
+    // bird's-eye 변환 (IPM_ENABLE)
+    BirdseyeView birdseye_;
+    cv::Mat warped_mask_;
 
     // 🔽 새롭게 추가할 멤버 변수
-    int prev_lane_gap_top_ = 120;    // 초기값: 대략적인 차선 간 거리
+    int prev_lane_gap_top_ = 120;    // 초기값: 대략적인 차선 간 거리 (추적 중 측정값으로 갱신)
     int prev_lane_gap_bottom_ = 120;
     int yellow_pixel_count_ = 0;
+
+    bool roi_remove_left_;   // 시작 값은 constants.json, 이후 setDriveMode()
+    bool white_line_drive_;
 };
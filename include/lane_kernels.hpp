@@ -0,0 +1,89 @@
+// lane_kernels.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include "frame_preprocessor.hpp"
+
+// 두 행 차선 검출 (LANE_MODEL = "two_row", IPM_ENABLE 아님) 의 픽셀 스캔 커널
+// - 노란 픽셀 수 (전처리가 분류한 행의 x_start 오른쪽) + 두 탐색 행의 가장 왼쪽/오른쪽 blob 중심
+// - 프레임 크기, 차선 색상(흰색/노란색), 좌측 ROI 제거 여부를 템플릿 인자로 고정한 특수화 버전
+//   -> 탐색 행/행 길이/마스크 선택이 컴파일 시점 상수, 루프 안 분기 없음
+// - 특수화되지 않은 크기이거나 LANE_KERNEL = "generic" 이면 LaneDetector 의 범용 경로 사용 (결과 동일)
+
+constexpr float LANE_TWO_ROW_Y[2] = {0.35f, 0.65f}; // 두 행 모드의 탐색 행 (높이 비율)
+constexpr int LANE_MIN_BLOB_SIZE = 10;             // 차선으로 인정하는 최소 run 길이
+constexpr int LANE_MAX_RUNS_PER_ROW = 64;          // 한 행에서 살펴보는 최대 run 수
+
+struct LaneScan {
+    int yellow_pixel_count = 0;
+    int row_y[2] = {0, 0};       // 탐색 행 y 좌표
+    int blob_count[2] = {0, 0};  // 행별 blob 수 (0~2, 스캔하지 않은 행은 0)
+    int blob_x[2][2] = {};       // 행별 [가장 왼쪽, 가장 오른쪽] blob 중심 (blob_count 개만 유효)
+};
+
+// rows: 스캔할 탐색 행 비트 (1: 위 행, 2: 아래 행), 추적 중인 행은 비워서 건너뜀
+// x_start: 좌측 ROI 제거 시작 열 (좌측 ROI 제거를 끈 커널은 무시하고 0 사용)
+using LaneScanFn = void (*)(const PreprocessedFrame& input, int x_start, unsigned rows, LaneScan& out);
+
+// 한 행에서 가장 왼쪽/오른쪽 blob 중심을 blob_x 에 기록하고 개수(0~2) 반환
+// - W > 0 이면 행 길이를 컴파일 시점 상수로 사용 (width 무시), W = 0 이면 width 사용
+// - 가장 왼쪽 blob은 화면 중앙 왼쪽에서 시작할 때만, 가장 오른쪽 blob은 중앙 오른쪽에서 끝날 때만 사용
+// - 행 오른쪽 끝에 닿아 끊기지 않은 blob은 제외
+template <int W>
+inline int scanLaneRow(const uchar* row_ptr, int width, int x_start, int blob_x[2]) {
+    const int w = W > 0 ? W : width;
+    int n = 0;
+    int first_start = 0, first_end = 0;
+    int last_start = 0, last_end = 0;
+    int prev_start = 0, prev_end = 0;  // 마지막 run 이 끝에 닿으면 대신 쓸 직전 run
+    int x = x_start;
+    while (x < w && n < LANE_MAX_RUNS_PER_ROW) {
+        if (!row_ptr[x]) { ++x; continue; }
+        int start = x;
+        while (x < w && row_ptr[x]) ++x;
+        if (x - start >= LANE_MIN_BLOB_SIZE) {
+            if (n == 0) { first_start = start; first_end = x - 1; }
+            prev_start = last_start; prev_end = last_end;
+            last_start = start; last_end = x - 1;
+            ++n;
+        }
+    }
+    if (n > 0 && last_end == w - 1) {
+        --n;
+        last_start = prev_start; last_end = prev_end;
+    }
+
+    int count = 0;
+    if (n > 0) {
+        int mid = w / 2;
+        if (first_start < mid) blob_x[count++] = (first_start + first_end) / 2;
+        if (last_end > mid) blob_x[count++] = (last_start + last_end) / 2;
+    }
+    return count;
+}
+
+// 프레임 크기와 주행 모드에 맞는 특수화 커널 (없으면 nullptr)
+LaneScanFn findLaneKernel(int width, int height, bool white_line_drive, bool roi_remove_left);
+
+// 프레임 크기 / 주행 모드가 바뀔 때만 커널을 다시 고르는 선택기 (프레임마다 호출)
+// - LANE_KERNEL = "generic" 이거나 특수화되지 않은 크기면 nullptr (범용 경로)
+class LaneKernelDispatcher {
+public:
+    LaneScanFn get(int width, int height, bool white_line_drive, bool roi_remove_left) {
+        if (!selected_ || width != width_ || height != height_ ||
+            white_line_drive != white_line_drive_ || roi_remove_left != roi_remove_left_) {
+            select(width, height, white_line_drive, roi_remove_left);
+        }
+        return kernel_;
+    }
+
+private:
+    void select(int width, int height, bool white_line_drive, bool roi_remove_left);
+
+    bool selected_ = false;
+    int width_ = 0;
+    int height_ = 0;
+    bool white_line_drive_ = true;
+    bool roi_remove_left_ = false;
+    LaneScanFn kernel_ = nullptr;
+};
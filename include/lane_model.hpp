@@ -0,0 +1,15 @@
+// lane_model.hpp
+#pragma once
+
+#include <vector>
+
+// 차선 모델 추정 결과 (이미지 좌표계, 픽셀 단위)
+struct LaneEstimate {
+    float offset = 0.0f;     // 화면 중앙 대비 차선 중심 오프셋 (제어 신호)
+    float heading = 0.0f;    // 차선 중심선 기울기 -dx/dy (양수: 위로 갈수록 오른쪽)
+    float curvature = 0.0f;  // 차선 중심선 2차 미분 d²x/dy² (1/px)
+};
+
+// 최소제곱 다항식 피팅: x = c[0] + c[1]*t + c[2]*t^2 (order 1 이면 c[2] = 0)
+// 점 개수가 order + 1 보다 적거나 행렬이 특이하면 false
+bool fitPolynomial(const std::vector<float>& ts, const std::vector<float>& xs, int order, double coeffs[3]);
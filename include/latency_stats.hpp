@@ -0,0 +1,34 @@
+// latency_stats.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// CLOCK_MONOTONIC 현재 시각 (ns, V4L2 캡처 시각/steady_clock 과 같은 기준)
+int64_t monotonicNs();
+
+// 지연 시간 표본 집계 (평균/표준편차/p50/p99/최대)
+// - 최근 capacity 개 표본만 보관하는 고정 크기 버퍼 (기록 시 힙 할당 없음)
+// - 한 스레드에서만 기록, report() 는 기록이 끝난 뒤 또는 같은 스레드에서 호출
+class LatencyStats {
+public:
+    explicit LatencyStats(size_t capacity = 4096);
+
+    void add(double ms);
+    // start_ns 부터 지금까지의 경과 시간 기록 (start_ns <= 0 이면 무시)
+    void addSince(int64_t start_ns);
+
+    size_t count() const { return count_; }
+    // "[INFO] label: n=.. 평균/표준편차/p50/p99/최대 .. ms" 한 줄 출력
+    void report(const std::string& label) const;
+
+private:
+    std::vector<double> samples_;
+    size_t next_ = 0;
+    size_t count_ = 0;
+    double sum_ = 0.0;
+    double sum_sq_ = 0.0;
+    double max_ = 0.0;
+};
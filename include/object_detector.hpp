@@ -3,20 +3,54 @@
 
 #include <opencv2/opencv.hpp>
 #include <vector>
+#include "frame_preprocessor.hpp"
+#include "component_analyzer.hpp"
+#include "checkerboard_detector.hpp"
+#include "debug_overlay.hpp"
 
 class ObjectDetector {
 public:
     ObjectDetector();
 
-    // 전처리 및 감지 실행
-    int process(const cv::Mat& frame, cv::Mat& vis_out, std::vector<bool>& detection_flags);
+    // 감지 실행 (전처리 번들을 입력으로 사용)
+    // 디버그 표시는 overlay 에 명령으로만 기록 (그리기는 호출자가 필요할 때 render)
+    int process(const PreprocessedFrame& input, DebugOverlay& overlay, std::vector<bool>& detection_flags);
+
+    // 개별 객체 감지 (작업 실행기에서 나눠 실행)
+    // 감지마다 내부 버퍼가 따로 있으므로 overlay 만 서로 다르면 세 감지를 동시에 호출해도 안전
+    // overlay 는 reset() 없이 명령만 추가
+    bool detectStopLine(const PreprocessedFrame& input, DebugOverlay& overlay);
+    bool detectCrosswalk(const PreprocessedFrame& input, DebugOverlay& overlay);
+    bool detectStartLine(const PreprocessedFrame& input, DebugOverlay& overlay);
+
+    // 정지선/횡단보도/출발선 ROI 의 행 합집합 (캡처 단계 ROI 자르기용)
+    static cv::Range requiredRows(int height);
 
 private:
-    // 영역 마스크 생성
-    cv::Mat createTrapezoidMask(int height, int width);
+    bool detectStopLine(const cv::Mat& grayscale, DebugOverlay& overlay, int height, int width);
+    bool detectCrosswalk(const cv::Mat& grayscale, DebugOverlay& overlay, int height, int width);
+    bool detectStartLine(const cv::Mat& grayscale, DebugOverlay& overlay, int height, int width);
+
+    // 검출별 ROI 픽셀 범위 (정지선은 전체 폭)
+    struct DetectionRois {
+        int height = 0;
+        int width = 0;
+        cv::Rect stop_line;
+        cv::Rect crosswalk;
+        cv::Rect start_line;
+    };
+    static DetectionRois computeRois(int height, int width);
+    // 주행 프레임 크기면 미리 계산한 값, 아니면 새로 계산 (읽기만 하므로 동시 호출 안전)
+    DetectionRois roisFor(int height, int width) const;
+    DetectionRois frame_rois_;
+
+    // 정지선/횡단보도 감지 각각의 연결 요소 분석기 (동시 실행용으로 분리)
+    ComponentAnalyzer stop_components_;
+    ComponentAnalyzer crosswalk_components_;
+
+    // 출발선 체크무늬 검출기 (STARTLINE_DETECTOR = "checker")
+    CheckerboardDetector checkerboard_;
 
-    // 개별 객체 감지 함수
-    bool detectStopLine(const cv::Mat& grayscale, cv::Mat& vis_out, int height, int width);
-    bool detectCrosswalk(const cv::Mat& grayscale, cv::Mat& vis_out, int height, int width);
-    bool detectStartLine(const cv::Mat& grayscale, cv::Mat& vis_out, int height, int width);
+    // 코너 기반 출발선 검출 결과 버퍼 (STARTLINE_DETECTOR = "gft")
+    std::vector<cv::Point2f> corners_;
 };
@@ -0,0 +1,23 @@
+// offset_extrapolator.hpp
+#pragma once
+
+#include <cstdint>
+#include "perception_result.hpp"
+
+// 차선 오프셋을 결과의 나이만큼 외삽 (고정 주기 제어 루프용)
+// - 최근 두 차선 결과(서로 다른 프레임)의 오프셋 변화율로 직선 외삽
+// - 외삽 시간은 max_ns 로 제한 (0 이면 외삽하지 않고 마지막 오프셋 그대로)
+// - 제어 스레드 전용
+class OffsetExtrapolator {
+public:
+    explicit OffsetExtrapolator(int64_t max_ns);
+
+    void push(const LaneResult& lane);
+    // now_ns 시점의 예상 오프셋 (결과가 없으면 0), at_ns 에 예상한 시각 (외삽 제한 적용 후)
+    int predict(int64_t now_ns, int64_t& at_ns) const;
+
+private:
+    int64_t max_ns_;
+    LaneResult last_;
+    double rate_ = 0.0;  // 오프셋 변화율 (1/ns)
+};
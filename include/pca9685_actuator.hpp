@@ -0,0 +1,31 @@
+// pca9685_actuator.hpp
+#pragma once
+
+#include "actuator.hpp"
+#include "i2c_bus.hpp"
+#include <cstdint>
+#include <memory>
+
+// PiRacer Pro 의 PCA9685 PWM 컨트롤러를 I2C 로 직접 구동 (piracer 파이썬 패키지와 같은 출력)
+// - 채널 0: 조향 (부호 반전), 채널 1: 스로틀 (ESC)
+// - 50Hz, 펄스 폭 1.5ms ± 0.5ms * 값 (값 -1.0 ~ 1.0)
+// - 두 채널의 LEDn_ON/OFF 레지스터(0x06 ~ 0x0D)가 연속이라 자동 증가로 한 트랜잭션에 씀
+// - 직전과 같은 레지스터 값이면 쓰지 않음
+class Pca9685Actuator : public Actuator {
+public:
+    explicit Pca9685Actuator(std::unique_ptr<I2cBus> bus);
+
+    bool open() override;
+    bool set(float steering, float throttle) override;
+    const char* name() const override { return "pca9685"; }
+
+    // 값(-1.0 ~ 1.0) -> PCA9685 12비트 OFF 카운트 (0x1000: 항상 켜짐)
+    static uint16_t pulseCount(float value);
+
+private:
+    bool writeRegister(uint8_t reg, uint8_t value);
+
+    std::unique_ptr<I2cBus> bus_;
+    uint16_t last_steering_ = 0xFFFF;  // 아직 쓰지 않음
+    uint16_t last_throttle_ = 0xFFFF;
+};
@@ -0,0 +1,67 @@
+// perception_graph.hpp
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include "task_executor.hpp"
+#include "frame_preprocessor.hpp"
+#include "lane_detector.hpp"
+#include "object_detector.hpp"
+#include "debug_overlay.hpp"
+#include "perception_result.hpp"
+#include "config.hpp"
+
+// 프레임 1장에 대한 검출 단계 작업 그래프
+//   전처리(카메라 스레드, FrameChannel) -> [차선 | 정지선 | 횡단보도 | 출발선] -> 합류
+// - 네 검출을 TaskExecutor 작업으로 나눠 실행하고 run() 이 모두 끝날 때까지 기다림
+// - 제어기가 준 DetectorSchedule 에 따라 이번 프레임에 필요 없는 검출은 작업을 만들지 않음
+// - 검출마다 별도 오버레이에 기록한 뒤 합류 단계에서 객체 오버레이로 합침
+// - run() 시작 시 최신 Config 를 고정해 모든 작업이 같은 설정으로 실행
+// - run() 은 한 스레드에서만 호출
+class PerceptionGraph {
+public:
+    // 작업 배치 (벤치마크 비교용, 주행은 GRAPH)
+    enum class Layout {
+        SERIAL,  // 한 스레드에서 차례로 실행
+        SPLIT,   // 기존 배치: [차선] | [정지선 -> 횡단보도 -> 출발선]
+        GRAPH    // 네 검출을 각각 작업으로 실행
+    };
+
+    explicit PerceptionGraph(TaskExecutor& executor);
+
+    // schedule 에 따라 이번 프레임에 실행할 검출만 작업으로 추가 (실행하지 않은 검출 결과는 false)
+    void run(const PreprocessedFrame& frame, uint64_t frame_id, LaneResult& lane, ObjectResult& object,
+             Layout layout = Layout::GRAPH, DetectorSchedule schedule = DetectorSchedule());
+
+    const DebugOverlay& laneOverlay() const { return lane_overlay_; }
+    const DebugOverlay& objectOverlay() const { return object_overlay_; }
+
+private:
+    static void runLane(void* self);
+    static void runStopLine(void* self);
+    static void runCrosswalk(void* self);
+    static void runStartLine(void* self);
+    static void runObjects(void* self);
+
+    TaskExecutor& executor_;
+    LaneDetector lane_detector_;
+    ObjectDetector object_detector_;
+
+    // 작업별 결과 (run() 동안만 유효)
+    const PreprocessedFrame* frame_ = nullptr;
+    ConfigPtr config_;  // 이번 프레임 설정 (다음 run() 까지 유지)
+    bool run_lane_ = true;
+    bool run_stop_ = true;
+    bool run_crosswalk_ = true;
+    bool run_start_ = true;
+    int lane_offset_ = 0;
+    int64_t lane_offset_ns_ = 0;  // lane_offset_ 을 계산한 프레임의 캡처 시각
+    LaneEstimate lane_estimate_;
+    bool stop_line_ = false;
+    bool crosswalk_ = false;
+    bool start_line_ = false;
+
+    DebugOverlay lane_overlay_;
+    DebugOverlay object_overlay_;    // 정지선 오버레이에 나머지를 합친 결과
+    DebugOverlay crosswalk_overlay_;
+    DebugOverlay start_overlay_;
+};
@@ -0,0 +1,59 @@
+// perception_result.hpp
+#pragma once
+
+#include <cstdint>
+
+// 차선 검출 스레드 결과 (프레임 1장 기준)
+struct LaneResult {
+    uint64_t frame_id = 0;       // FrameChannel 프레임 ID (0: 아직 없음)
+    int64_t capture_ns = 0;      // 해당 프레임 캡처 시각 (CLOCK_MONOTONIC)
+    int offset = 0;              // 차선 중심 오프셋
+    int64_t offset_ns = 0;       // offset 이 가리키는 시각 (보통 capture_ns, 외삽하면 외삽 시각)
+    int frame_offset = 0;        // 프레임에서 측정한 오프셋 (외삽해도 바뀌지 않음)
+    int64_t frame_offset_ns = 0; // frame_offset 을 측정한 프레임의 캡처 시각
+    float heading = 0.0f;        // 차선 중심선 기울기 (LaneEstimate)
+    float curvature = 0.0f;      // 차선 중심선 곡률 (LaneEstimate, LANE_MODEL = "fit" 일 때만)
+    int yellow_pixel_count = 0;  // 노란색 차선 픽셀 수
+};
+
+// 객체 검출 스레드 결과 (프레임 1장 기준)
+struct ObjectResult {
+    uint64_t frame_id = 0;
+    int64_t capture_ns = 0;
+    bool stop_line = false;
+    bool crosswalk = false;
+    bool start_line = false;
+};
+
+// 제어기에 넘기는 인식 결과 묶음
+// - coherent 이면 lane/object 가 같은 프레임의 결과
+// - 아니면 JOIN_POLICY 에 따라 각 검출기의 최신 결과를 합친 것
+struct PerceptionSnapshot {
+    LaneResult lane;
+    ObjectResult object;
+    uint64_t frame_id = 0;   // 묶음에 포함된 가장 최근 프레임 ID
+    int64_t capture_ns = 0;  // 그 프레임의 캡처 시각 (지연 측정 기준)
+    bool coherent = false;
+};
+
+// 제어기가 인식 단계에 알려주는 프레임 처리 지시
+// - 검출기별 실행 간격 (주행 상태에 따라 관심 검출기만 매 프레임)
+//   0: 건너뜀, 1: 매 프레임, N: 프레임 ID 가 N 의 배수일 때만 (실행하지 않은 프레임의 결과는 false)
+// - 차선 검출 주행 모드 (노란 차선 구간에서 좌측 ROI 제거 + 노란 차선 추종)
+// 8바이트라 std::atomic 으로 잠금 없이 주고받음
+struct DetectorSchedule {
+    uint8_t lane = 1;        // 제어기는 항상 1 (건너뛴 프레임은 직전 오프셋 유지)
+    uint8_t stop_line = 1;
+    uint8_t crosswalk = 1;
+    uint8_t start_line = 1;
+    bool roi_remove_left = false;
+    bool white_line_drive = true;
+    uint8_t reserved[2] = {0, 0};
+
+    bool operator==(const DetectorSchedule& other) const {
+        return lane == other.lane && stop_line == other.stop_line &&
+               crosswalk == other.crosswalk && start_line == other.start_line &&
+               roi_remove_left == other.roi_remove_left && white_line_drive == other.white_line_drive;
+    }
+    bool operator!=(const DetectorSchedule& other) const { return !(*this == other); }
+};
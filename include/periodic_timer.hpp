@@ -0,0 +1,23 @@
+// periodic_timer.hpp
+#pragma once
+
+#include <cstdint>
+
+// timerfd(CLOCK_MONOTONIC) 기반 고정 주기 타이머
+// - wait() 는 다음 주기 시작까지 블로킹, 그동안 지나간 주기 수를 돌려줌 (1 보다 크면 주기를 놓침)
+// - 주기는 시작 시각 기준 절대 간격이라 처리 시간이 달라도 누적 오차 없음
+class PeriodicTimer {
+public:
+    explicit PeriodicTimer(int64_t period_ns);
+    ~PeriodicTimer();
+
+    bool start();
+    // 주기 경과 횟수 (실패 시 0)
+    uint64_t wait();
+
+    int64_t periodNs() const { return period_ns_; }
+
+private:
+    int64_t period_ns_;
+    int fd_ = -1;
+};
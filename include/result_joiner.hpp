@@ -0,0 +1,69 @@
+// result_joiner.hpp
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include "perception_result.hpp"
+#include "spsc_queue.hpp"
+
+// 차선/객체 검출 결과를 프레임 ID 로 맞춰 제어기에 한 묶음씩 넘기는 합류 단계
+// - 검출 스레드마다 SPSC 큐 하나 (검출 스레드 -> 제어 스레드), 큐가 차면 가장 새 결과를 버림
+// - JOIN_POLICY = "wait"     : 두 검출기가 같은 프레임 결과를 낼 때까지 기다림
+//                              JOIN_TIMEOUT_MS 안에 짝이 안 맞으면 최신 결과끼리 합쳐 넘김
+// - JOIN_POLICY = "freshest" : 어느 쪽이든 새 결과가 오면 바로 최신 결과끼리 합쳐 넘김
+// - next() 는 제어 스레드 한 곳에서만 호출
+class ResultJoiner {
+public:
+    ResultJoiner();
+
+    void pushLane(const LaneResult& result);      // 차선 검출 스레드 전용
+    void pushObject(const ObjectResult& result);  // 객체 검출 스레드 전용
+
+    // 다음 묶음이 준비될 때까지 대기 (시간 초과/닫힘이면 false)
+    bool next(PerceptionSnapshot& out, std::chrono::milliseconds timeout);
+
+    // 대기 중인 next() 를 깨우고 이후 대기는 즉시 반환
+    void close();
+
+    // 통계 한 줄 출력 (제어 스레드 종료 시)
+    void report() const;
+
+private:
+    static constexpr size_t QUEUE_SIZE = 8;
+    static constexpr size_t HISTORY = 8; // 짝 맞추기에 쓰는 최근 결과 수
+
+    void wake();
+    void drain();
+    bool tryJoin(PerceptionSnapshot& out, int64_t now_ns);
+    void emit(PerceptionSnapshot& out, const LaneResult& lane, const ObjectResult& object, bool coherent);
+
+    SpscQueue<LaneResult, QUEUE_SIZE> lane_queue_;
+    SpscQueue<ObjectResult, QUEUE_SIZE> object_queue_;
+
+    // 이하 제어 스레드 전용
+    std::array<LaneResult, HISTORY> lane_history_{};
+    std::array<ObjectResult, HISTORY> object_history_{};
+    size_t lane_next_ = 0;
+    size_t object_next_ = 0;
+    LaneResult lane_latest_;
+    ObjectResult object_latest_;
+    uint64_t emitted_id_ = 0;       // 마지막으로 넘긴 묶음의 프레임 ID
+    uint64_t emitted_lane_id_ = 0;
+    uint64_t emitted_object_id_ = 0;
+    int64_t pending_since_ns_ = 0;  // 짝을 기다리기 시작한 시각 (0: 대기 없음)
+    uint64_t joined_ = 0;
+    uint64_t partial_ = 0;
+
+    bool wait_policy_ = true;       // JOIN_POLICY == "wait"
+    int64_t join_timeout_ns_ = 0;
+
+    std::atomic<uint64_t> queue_full_{0};
+    std::atomic<bool> closed_{false};
+    std::atomic<int> waiters_{0};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+};
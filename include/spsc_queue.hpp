@@ -0,0 +1,43 @@
+// spsc_queue.hpp
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// 단일 생산자/단일 소비자 고정 크기 링 버퍼 (잠금/할당 없음)
+// - push() 는 생산자 스레드에서만, pop() 은 소비자 스레드에서만 호출
+// - 가득 차면 push() 가 false 를 반환 (호출자가 버릴지 결정)
+// - 실제 저장 가능 개수는 N - 1
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert(N >= 2, "SpscQueue 크기는 2 이상이어야 합니다.");
+
+public:
+    bool push(const T& value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t next = (head + 1) % N;
+        if (next == tail_.load(std::memory_order_acquire)) return false;
+        items_[head] = value;
+        head_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return false;
+        value = items_[tail];
+        tail_.store((tail + 1) % N, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, N> items_{};
+    // 생산자/소비자 인덱스를 서로 다른 캐시 라인에 둠
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
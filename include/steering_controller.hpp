@@ -0,0 +1,33 @@
+// steering_controller.hpp
+#pragma once
+
+#include <cstdint>
+#include "perception_result.hpp"
+
+// 차선 결과 -> 조향/스로틀 제어 법칙
+// 조향 = 중립값(trim) + P + I + D + 피드포워드 (범위 -0.7 ~ 0.7)
+// - 지연 보상 (STEERING_LATENCY_COMP): 오프셋이 가리키는 시각(offset_ns)부터
+//   지금 + STEERING_ACTUATION_DELAY_MS 까지 오프셋 변화율로 앞당겨 예측한 값을 오차로 사용
+//   (보상 시간은 STEERING_LATENCY_MAX_MS 로 제한)
+// - 변화율은 측정 오프셋(frame_offset)과 그 프레임 시각 기준 (제어 주기, 외삽과 무관), STEERING_D_FILTER 로 저역 통과
+//   (외삽한 offset 을 쓰면 새 프레임이 예측을 보정할 때마다 D 항이 튐)
+// - 피드포워드: 차선 기울기(heading), 곡률(curvature) 비례
+// 스로틀 (THROTTLE_SCHEDULING): 직선(기울기/곡률/오프셋이 작음)일수록 MAX_THROTTLE, 굽을수록 BASE_THROTTLE
+// 추가 이득의 기본값은 0 이라 기존 P 제어 + BASE_THROTTLE 과 같은 출력
+// 값은 호출 스레드가 고정한 Config 에서 읽음, 제어 스레드 전용
+class SteeringController {
+public:
+    // trim: 조향 중립값 (STEERING_OFFSET 또는 STEERING_OFFSET_2)
+    float steering(const LaneResult& lane, int64_t now_ns, float trim);
+    float throttle(const LaneResult& lane) const;
+
+    // 적분/변화율 초기화 (수동 모드, 정지 상태)
+    void reset();
+
+private:
+    int64_t last_ns_ = 0;       // 마지막으로 반영한 측정 오프셋의 프레임 시각
+    float last_offset_ = 0.0f;
+    float rate_ = 0.0f;         // 오프셋 변화율 (px/s, 저역 통과)
+    float integral_ = 0.0f;     // 오차 적분 (px*s)
+    int64_t last_update_ns_ = 0;
+};
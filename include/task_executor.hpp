@@ -0,0 +1,81 @@
+// task_executor.hpp
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 같이 기다릴 작업 묶음 (프레임 하나의 검출 단계 등)
+class TaskGroup {
+public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+private:
+    friend class TaskExecutor;
+    std::atomic<int> pending_{0};
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+};
+
+// 프레임 단위 작업용 소형 work-stealing 실행기
+// - 작업자마다 고정 크기 큐 (힙 할당 없음), 자기 큐는 뒤에서 꺼내고 비면 다른 큐 앞에서 훔침
+// - 작업은 함수 포인터 + 문맥 포인터 (캡처 없는 람다 사용, std::function 할당 없음)
+// - wait() 를 부른 스레드도 남은 작업을 훔쳐 실행하므로 작업자 수 + 1 개 코어를 사용
+// - 작업자 스레드는 "<name><번호>" 이름의 THREAD_PROFILE 적용
+class TaskExecutor {
+public:
+    using Fn = void (*)(void* ctx);
+
+    TaskExecutor(int workers, const std::string& name);
+    ~TaskExecutor();
+
+    // 작업 추가 (큐가 가득 차면 호출 스레드에서 바로 실행)
+    void submit(TaskGroup& group, Fn fn, void* ctx);
+    // group 의 작업이 모두 끝날 때까지 남은 작업을 함께 실행하며 대기
+    void wait(TaskGroup& group);
+
+    int workers() const { return static_cast<int>(queues_.size()); }
+
+private:
+    struct Task {
+        Fn fn = nullptr;
+        void* ctx = nullptr;
+        TaskGroup* group = nullptr;
+    };
+
+    // 작업자 큐: 소유 작업자는 뒤(LIFO), 다른 스레드는 앞(FIFO)에서 꺼냄
+    struct Queue {
+        static constexpr int CAPACITY = 64;
+        std::mutex mutex;
+        std::array<Task, CAPACITY> tasks;
+        int head = 0;  // 가장 오래된 작업
+        int size = 0;
+    };
+
+    bool push(int queue, const Task& task);
+    bool popBack(int queue, Task& task);
+    bool stealFront(int queue, Task& task);
+    // 시작 위치부터 모든 큐를 돌며 작업 하나 확보
+    bool findTask(int start, Task& task);
+    void run(const Task& task);
+    void workerLoop(int index, std::string name);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<unsigned> next_queue_{0};
+    std::atomic<bool> stop_{false};
+
+    // 일이 없을 때 작업자 대기 (epoch_ 가 바뀌면 새 작업이 있다는 뜻)
+    std::atomic<uint64_t> epoch_{0};
+    std::atomic<int> sleepers_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+};
@@ -0,0 +1,30 @@
+// thread_profile.hpp
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "latency_stats.hpp"
+
+// constants.json 실행 프로파일 적용
+// - THREAD_PROFILE: 스레드 이름 -> [CPU 번호(-1: 고정 안 함), SCHED_FIFO 우선순위(0: 일반 스케줄링)]
+//   스레드 이름: camera, perception, worker0.. (EXECUTOR_WORKERS 개), control, gamepad, actuator, recorder, config
+// - MEMORY_LOCK: mlockall 로 페이지 고정 + PREFAULT_HEAP_MB 만큼 힙 미리 확보
+// 권한 부족(CAP_SYS_NICE, RLIMIT_MEMLOCK) 등으로 실패하면 경고만 출력하고 계속 실행
+
+// 호출한 스레드에 이름/CPU 고정/우선순위 적용 (MEMORY_LOCK 이면 스택도 미리 페이지 할당)
+void applyThreadProfile(const char* name);
+
+// 프로세스 메모리 고정 및 힙 미리 할당 (스레드 생성 전 한 번 호출)
+void lockProcessMemory();
+
+// 스레드 루프 주기 측정 (tick 사이 간격의 평균/표준편차/p99/최대)
+class PeriodJitter {
+public:
+    // 루프 한 바퀴마다 호출
+    void tick();
+    void report(const std::string& name) const;
+
+private:
+    LatencyStats periods_;
+    int64_t last_ns_ = 0;
+};
@@ -1,12 +1,27 @@
 #pragma once
 
 #include <opencv2/opencv.hpp>
+#include <memory>
+#include "frame_source.hpp"
 
+// 카메라 캡처 래퍼 (CAMERA_BACKEND: "gstreamer" | "v4l2" | "file")
+// - read() 는 FRAME_WIDTH x FRAME_HEIGHT BGR 프레임을 반환
+// - 장치가 이미 그 크기의 BGR 을 주면 드라이버 버퍼를 복사 없이 그대로 넘기고,
+//   그 외 형식(Bayer/YUYV)이나 크기는 변환 후 넘김 (setCropRows 로 지정한 행만 변환)
 class USBCam {
 public:
-    bool init();             // 카메라 초기화
-    cv::Mat getFrame();      // 프레임 가져오기 (320x200으로 리사이즈)
+    USBCam();
+    ~USBCam();
+
+    bool init();                     // 카메라 초기화
+    // 최신 프레임 가져오기 (keep_bayer: Bayer 원본이면 변환 없이 그대로 반환)
+    bool read(CapturedFrame& out, bool keep_bayer = false);
+    const char* backendName() const;
+
+    // 변환/축소할 출력 행 범위 (FRAME_HEIGHT 기준), 범위 밖 행은 0으로 채움
+    void setCropRows(cv::Range rows);
 
 private:
-    cv::VideoCapture cap;    // OpenCV GStreamer 캡처 객체
+    std::unique_ptr<FrameSource> source_;
+    cv::Range crop_rows_ = cv::Range::all();
 };
@@ -0,0 +1,47 @@
+// v4l2_capture.hpp
+#pragma once
+
+#include "frame_source.hpp"
+#include <vector>
+
+// V4L2 mmap 스트리밍 캡처
+// - 드라이버 버퍼를 mmap 으로 매핑해 DQBUF 한 버퍼를 그대로 cv::Mat 헤더로 넘김
+// - read() 는 큐에 쌓인 버퍼를 모두 꺼내 가장 최신 것만 남기고 나머지는 즉시 QBUF
+// - 넘겨준 버퍼는 hold 참조가 모두 사라진 뒤 다음 read() 에서 드라이버에 반환
+class V4l2Capture : public FrameSource {
+public:
+    V4l2Capture(const std::string& device, int width, int height, uint32_t fourcc, int buffer_count);
+    ~V4l2Capture() override;
+
+    bool open() override;
+    bool read(CapturedFrame& out) override;
+    const char* name() const override { return "v4l2"; }
+
+private:
+    struct Buffer {
+        void* start = nullptr;
+        size_t length = 0;
+        bool queued = false;
+        std::shared_ptr<int> token;  // 하류로 넘긴 참조 수 추적용
+    };
+
+    bool queueBuffer(int index);
+    void recycleBuffers();
+    bool waitForReleasedBuffer();
+    void close();
+
+    std::string device_;
+    int width_;
+    int height_;
+    uint32_t fourcc_;
+    int buffer_count_;
+    size_t stride_ = 0;
+
+    int fd_ = -1;
+    bool streaming_ = false;
+    std::vector<Buffer> buffers_;
+
+    // 모든 버퍼가 하류에 잡혀 있던 횟수 (경고를 초당 1번으로 묶어서 출력)
+    int64_t last_held_warn_ns_ = 0;
+    int held_waits_ = 0;
+};
@@ -1,7 +1,13 @@
 // video_recorder.hpp
 #pragma once
 #include <opencv2/opencv.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
+#include "spsc_queue.hpp"
 
 class VideoRecorder {
 public:
@@ -12,7 +18,24 @@ public:
     void write(const cv::Mat& frame);
     void release();
 
+    // 인코딩을 별도 녹화 스레드("recorder" 프로파일)로 분리
+    // - 이후 write() 는 미리 할당한 버퍼에 복사만 하고 반환, 버퍼가 모두 차 있으면 그 프레임은 버림
+    void startThread(int buffer_count = 3);
+
 private:
+    void threadLoop();
+
     cv::VideoWriter writer;
     bool initialized;
-};
\ No newline at end of file
+
+    // 녹화 스레드 (startThread 이후에만 사용)
+    static constexpr size_t QUEUE_SIZE = 8;
+    std::vector<cv::Mat> buffers_;
+    SpscQueue<int, QUEUE_SIZE> filled_; // 호출 스레드 -> 녹화 스레드
+    SpscQueue<int, QUEUE_SIZE> free_;   // 녹화 스레드 -> 호출 스레드
+    std::thread thread_;
+    std::atomic<bool> thread_running_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    long dropped_ = 0;
+};
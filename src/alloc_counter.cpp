@@ -0,0 +1,61 @@
+#include "alloc_counter.hpp"
+
+#ifdef ALLOC_COUNT
+
+#include <atomic>
+#include <cerrno>
+
+namespace {
+std::atomic<size_t> g_alloc_count{0};
+}
+
+// glibc 내부 할당 함수로 위임하고 호출 횟수만 기록
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+void* malloc(size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = __libc_memalign(alignment, size);
+    if (!ptr) return ENOMEM;
+    *out = ptr;
+    return 0;
+}
+}
+
+bool allocCountEnabled() { return true; }
+size_t allocCount() { return g_alloc_count.load(std::memory_order_relaxed); }
+
+#else
+
+bool allocCountEnabled() { return false; }
+size_t allocCount() { return 0; }
+
+#endif
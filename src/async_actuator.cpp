@@ -0,0 +1,91 @@
+#include "async_actuator.hpp"
+#include "thread_profile.hpp"
+#include <cmath>
+#include <iostream>
+
+AsyncActuator::AsyncActuator(std::unique_ptr<Actuator> inner, float epsilon)
+    : inner_(std::move(inner)), epsilon_(epsilon) {}
+
+AsyncActuator::~AsyncActuator() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) thread_.join();
+
+    wait_latency_.report(std::string("actuator 명령 대기 (") + inner_->name() + ")");
+    dispatch_latency_.report(std::string("actuator 출력 (") + inner_->name() + ")");
+    std::cout << "[INFO] actuator 변화 없음으로 생략한 명령: " << coalesced_ << std::endl;
+}
+
+bool AsyncActuator::stop() {
+    if (!thread_.joinable()) return inner_->set(0.0f, 0.0f);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        steering_ = 0.0f;
+        throttle_ = 0.0f;
+        command_ns_ = monotonicNs();
+        pending_ = true;
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+    return last_delivered_;
+}
+
+bool AsyncActuator::open() {
+    if (!inner_->open()) return false;
+    thread_ = std::thread(&AsyncActuator::workerLoop, this);
+    return true;
+}
+
+bool AsyncActuator::set(float steering, float throttle) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        steering_ = steering;
+        throttle_ = throttle;
+        command_ns_ = monotonicNs();
+        pending_ = true;
+    }
+    cv_.notify_one();
+    return true;
+}
+
+void AsyncActuator::workerLoop() {
+    applyThreadProfile("actuator");
+    while (true) {
+        float steering, throttle;
+        int64_t command_ns;
+        bool last;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&] { return pending_ || stop_; });
+            // 종료 요청이 와도 남은 명령은 먼저 출력
+            if (!pending_) return;
+            steering = steering_;
+            throttle = throttle_;
+            command_ns = command_ns_;
+            last = stop_;
+            pending_ = false;
+        }
+        wait_latency_.addSince(command_ns);
+
+        // 종료 직전 명령(모터 정지)은 생략하지 않음
+        if (!last && sent_ && std::fabs(steering - sent_steering_) <= epsilon_ &&
+            std::fabs(throttle - sent_throttle_) <= epsilon_) {
+            ++coalesced_;
+            continue;
+        }
+
+        const int64_t start_ns = monotonicNs();
+        const bool ok = inner_->set(steering, throttle);
+        if (ok) {
+            sent_ = true;
+            sent_steering_ = steering;
+            sent_throttle_ = throttle;
+        }
+        if (last) last_delivered_ = ok;
+        dispatch_latency_.addSince(start_ns);
+    }
+}
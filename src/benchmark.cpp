@@ -0,0 +1,737 @@
+// benchmark.cpp
+#include "benchmark.hpp"
+#include "constants.hpp"
+#include "config.hpp"
+#include "frame_preprocessor.hpp"
+#include "frame_channel.hpp"
+#include "perception_graph.hpp"
+#include "latency_stats.hpp"
+#include "checkerboard_detector.hpp"
+#include "lane_detector.hpp"
+#include "lane_kernels.hpp"
+#include "birdseye_view.hpp"
+#include "object_detector.hpp"
+#include "alloc_counter.hpp"
+#include "usb_cam.hpp"
+#include "i2c_bus.hpp"
+#include "pca9685_actuator.hpp"
+#include "evdev_gamepad.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <ctime>
+#include <memory>
+#include <thread>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int MAX_FRAMES = 300;        // 영상에서 읽을 최대 프레임 수
+constexpr int SYNTHETIC_FRAMES = 100;  // 영상이 없을 때 생성할 합성 프레임 수
+
+// 영상 파일에서 프레임 로드
+std::vector<cv::Mat> loadFrames(const std::string& path) {
+    std::vector<cv::Mat> frames;
+    cv::VideoCapture cap(path);
+    if (!cap.isOpened()) {
+        std::cerr << "[ERROR] 벤치마크 영상 열기 실패: " << path << std::endl;
+        return frames;
+    }
+    cv::Mat frame;
+    while (static_cast<int>(frames.size()) < MAX_FRAMES && cap.read(frame)) {
+        frames.push_back(frame.clone());
+    }
+    return frames;
+}
+
+// 노이즈 섞인 도로 + 흰색/노란색 차선 합성 프레임
+std::vector<cv::Mat> makeSyntheticFrames(int count, cv::Size size) {
+    std::vector<cv::Mat> frames;
+    uint32_t seed = 12345;
+    for (int i = 0; i < count; ++i) {
+        cv::Mat frame(size, CV_8UC3);
+        for (int y = 0; y < frame.rows; ++y) {
+            uchar* p = frame.ptr<uchar>(y);
+            for (int x = 0; x < frame.cols * 3; ++x) {
+                seed = seed * 1664525u + 1013904223u;
+                p[x] = static_cast<uchar>(seed >> 24);
+            }
+        }
+        int shift = (i % 20) - 10;
+        cv::rectangle(frame, cv::Rect(size.width / 6 + shift, 0, size.width / 16, size.height), cv::Scalar(235, 235, 235), cv::FILLED);
+        cv::rectangle(frame, cv::Rect(size.width * 3 / 4 + shift, 0, size.width / 16, size.height), cv::Scalar(40, 200, 220), cv::FILLED);
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+std::vector<cv::Mat> resizeFrames(const std::vector<cv::Mat>& source, cv::Size size) {
+    std::vector<cv::Mat> frames(source.size());
+    for (size_t i = 0; i < source.size(); ++i) {
+        cv::resize(source[i], frames[i], size);
+    }
+    return frames;
+}
+
+// 프레임당 평균 처리 시간 (ms), 첫 프레임으로 한 번 예열 후 측정
+template <typename T, typename Fn>
+double measureMs(const std::vector<T>& frames, Fn&& fn) {
+    fn(frames.front());
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& frame : frames) fn(frame);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames.size();
+}
+
+// 실제 주행 크기로 전처리한 번들 (전처리기 내부 버퍼와 분리되도록 복사본 보관)
+std::vector<PreprocessedFrame> preprocessFrames(const std::vector<cv::Mat>& source) {
+    auto frames = resizeFrames(source, cv::Size(FRAME_WIDTH, FRAME_HEIGHT));
+    FramePreprocessor preprocessor;
+    PreprocessedFrame out;
+    std::vector<PreprocessedFrame> bundles;
+    for (const auto& frame : frames) {
+        preprocessor.process(frame, out);
+        PreprocessedFrame copy;
+        copy.frame = out.frame.clone();
+        copy.roi_mask = out.roi_mask.clone();
+        copy.white_mask = out.white_mask.clone();
+        copy.yellow_mask = out.yellow_mask.clone();
+        copy.grayscale = out.grayscale.clone();
+        copy.classified_rows = out.classified_rows;
+        bundles.push_back(copy);
+    }
+    return bundles;
+}
+
+// HSV 변환 경로 vs LUT 분류기 경로 (처리 시간 및 결과 일치 여부)
+void benchColorClassifier(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 색상 분류: HSV vs LUT\n";
+    const std::string saved = COLOR_CLASSIFIER;
+
+    for (cv::Size size : {cv::Size(320, 200), cv::Size(640, 240)}) {
+        auto frames = resizeFrames(source, size);
+        FramePreprocessor preprocessor;
+        PreprocessedFrame hsv_out, lut_out;
+
+        COLOR_CLASSIFIER = "hsv";
+        double hsv_ms = measureMs(frames, [&](const cv::Mat& f) { preprocessor.process(f, hsv_out); });
+        COLOR_CLASSIFIER = "lut";
+        double lut_ms = measureMs(frames, [&](const cv::Mat& f) { preprocessor.process(f, lut_out); });
+
+        // 두 경로의 클래스 이미지 비교
+        long mismatch = 0;
+        for (const auto& frame : frames) {
+            COLOR_CLASSIFIER = "hsv";
+            preprocessor.process(frame, hsv_out);
+            COLOR_CLASSIFIER = "lut";
+            preprocessor.process(frame, lut_out);
+            cv::Mat diff;
+            cv::compare(hsv_out.grayscale, lut_out.grayscale, diff, cv::CMP_NE);
+            mismatch += cv::countNonZero(diff);
+        }
+
+        std::cout << "  " << size.width << "x" << size.height << std::fixed << std::setprecision(3)
+                  << " | hsv: " << hsv_ms << " ms"
+                  << " | lut: " << lut_ms << " ms"
+                  << " | 불일치 픽셀: " << mismatch << "\n";
+    }
+
+    COLOR_CLASSIFIER = saved;
+}
+
+// 출발선 검출: goodFeaturesToTrack vs 체크무늬 run-length 검출기
+// 녹화된 출발선 영상으로 실행하면 두 방식의 검출 프레임 수와 일치율도 함께 확인 가능
+void benchStartLine(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 출발선 검출: GFT vs checker\n";
+
+    // 실제 주행과 같은 크기/분류기로 클래스 이미지 준비
+    auto frames = resizeFrames(source, cv::Size(FRAME_WIDTH, FRAME_HEIGHT));
+    FramePreprocessor preprocessor;
+    PreprocessedFrame out;
+    std::vector<cv::Mat> rois;
+    for (const auto& frame : frames) {
+        preprocessor.process(frame, out);
+        const cv::Mat& grayscale = out.grayscale;
+        int y1 = static_cast<int>(grayscale.rows * STARTLINE_DETECTION_Y1);
+        int y2 = static_cast<int>(grayscale.rows * STARTLINE_DETECTION_Y2);
+        int x1 = static_cast<int>(grayscale.cols * STARTLINE_DETECTION_X1);
+        int x2 = static_cast<int>(grayscale.cols * STARTLINE_DETECTION_X2);
+        rois.push_back(grayscale(cv::Range(y1, y2), cv::Range(x1, x2)).clone());
+    }
+
+    std::vector<bool> gft_hits, checker_hits;
+    double gft_ms = measureMs(rois, [&](const cv::Mat& roi) {
+        std::vector<cv::Point2f> corners;
+        cv::goodFeaturesToTrack(roi, corners, GFT_MAX_CORNER_QUANTITY, config().GFT_CORNER_QUALITY_LEVEL, config().GFT_MIN_CORNER_DISTANCE);
+        gft_hits.push_back(static_cast<int>(corners.size()) >= config().STARTLINE_DETECTION_THRESHOLD);
+    });
+    CheckerboardDetector checkerboard;
+    double checker_ms = measureMs(rois, [&](const cv::Mat& roi) {
+        checker_hits.push_back(checkerboard.detect(roi));
+    });
+
+    // 예열 호출 결과 제외
+    gft_hits.erase(gft_hits.begin());
+    checker_hits.erase(checker_hits.begin());
+    int gft_count = 0, checker_count = 0, agree = 0;
+    for (size_t i = 0; i < gft_hits.size(); ++i) {
+        gft_count += gft_hits[i];
+        checker_count += checker_hits[i];
+        agree += (gft_hits[i] == checker_hits[i]);
+    }
+
+    std::cout << "  " << FRAME_WIDTH << "x" << FRAME_HEIGHT << std::fixed << std::setprecision(3)
+              << " | gft: " << gft_ms << " ms (" << gft_count << " 검출)"
+              << " | checker: " << checker_ms << " ms (" << checker_count << " 검출)"
+              << " | 일치: " << agree << "/" << gft_hits.size() << "\n";
+}
+
+// 차선 추정: 두 행 전체 스캔 vs 두 행 추적 vs 다중 행 피팅
+void benchLaneModel(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 차선 추정: two_row vs two_row+tracking vs fit(" << LANE_FIT_ROWS << " rows)\n";
+    auto bundles = preprocessFrames(source);
+    const std::string saved_model = LANE_MODEL;
+    const bool saved_tracking = LANE_TRACKING;
+
+    struct Variant { const char* name; const char* model; bool tracking; };
+    for (const Variant& v : {Variant{"two_row", "two_row", false},
+                             Variant{"two_row+tracking", "two_row", true},
+                             Variant{"fit", "fit", false}}) {
+        LANE_MODEL = v.model;
+        LANE_TRACKING = v.tracking;
+        LaneDetector detector;
+        DebugOverlay overlay;
+        double sum_abs_offset = 0.0;
+        double ms = measureMs(bundles, [&](const PreprocessedFrame& b) {
+            sum_abs_offset += std::abs(detector.process(b, overlay));
+        });
+        std::cout << "  " << v.name << std::fixed << std::setprecision(3)
+                  << " | " << ms << " ms"
+                  << " | 평균 |offset|: " << sum_abs_offset / (bundles.size() + 1) << "\n";
+    }
+
+    LANE_MODEL = saved_model;
+    LANE_TRACKING = saved_tracking;
+}
+
+// 두 행 차선 스캔: 범용 경로 (런타임 크기/모드) vs 특수화 커널 (프레임 크기/주행 모드 고정)
+// - 커널 단독: 주행 모드 4가지 각각 노란 픽셀 수 + 두 행 blob 결과 비교
+// - LaneDetector::process 전체: LANE_KERNEL = "generic" vs "specialized" 오프셋 비교
+void benchLaneKernels(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 두 행 차선 스캔: generic vs specialized (" << FRAME_WIDTH << "x" << FRAME_HEIGHT << ")\n";
+    auto bundles = preprocessFrames(source);
+    if (!findLaneKernel(FRAME_WIDTH, FRAME_HEIGHT, true, false)) {
+        std::cout << "  이 프레임 크기의 특수화 커널 없음 (lane_kernels.cpp KERNEL_SETS) → 건너뜀\n";
+        return;
+    }
+    const int x_threshold = std::clamp(config().ROI_REMOVE_LEFT_X_THRESHOLD + 1, 0, FRAME_WIDTH);
+
+    for (bool white_line_drive : {true, false}) {
+        for (bool roi_remove_left : {false, true}) {
+            const int x_start = roi_remove_left ? x_threshold : 0;
+            LaneScanFn kernel = findLaneKernel(FRAME_WIDTH, FRAME_HEIGHT, white_line_drive, roi_remove_left);
+            std::vector<LaneScan> generic(bundles.size()), specialized(bundles.size());
+
+            size_t index = 0;
+            double generic_ms = measureMs(bundles, [&](const PreprocessedFrame& b) {
+                LaneScan& out = generic[index++ % bundles.size()];
+                const int y_begin = std::clamp(b.classified_rows.start, 0, b.yellow_mask.rows);
+                const int y_end = std::clamp(b.classified_rows.end, y_begin, b.yellow_mask.rows);
+                out.yellow_pixel_count = cv::countNonZero(b.yellow_mask(cv::Range(y_begin, y_end), cv::Range(x_start, b.yellow_mask.cols)));
+                const cv::Mat& mask = white_line_drive ? b.white_mask : b.yellow_mask;
+                for (int i = 0; i < 2; ++i) {
+                    out.row_y[i] = static_cast<int>(mask.rows * LANE_TWO_ROW_Y[i]);
+                    out.blob_count[i] = scanLaneRow<0>(mask.ptr<uchar>(out.row_y[i]), mask.cols, x_start, out.blob_x[i]);
+                }
+            });
+            index = 0;
+            double specialized_ms = measureMs(bundles, [&](const PreprocessedFrame& b) {
+                kernel(b, x_start, 3u, specialized[index++ % bundles.size()]);
+            });
+
+            long mismatch = 0;
+            for (size_t i = 0; i < bundles.size(); ++i) {
+                const LaneScan& g = generic[i];
+                const LaneScan& s = specialized[i];
+                bool same = g.yellow_pixel_count == s.yellow_pixel_count;
+                for (int r = 0; r < 2 && same; ++r) {
+                    same = g.row_y[r] == s.row_y[r] && g.blob_count[r] == s.blob_count[r];
+                    for (int k = 0; k < g.blob_count[r] && same; ++k) same = g.blob_x[r][k] == s.blob_x[r][k];
+                }
+                if (!same) ++mismatch;
+            }
+            std::cout << "  " << (white_line_drive ? "white" : "yellow") << (roi_remove_left ? "+remove_left" : "")
+                      << std::fixed << std::setprecision(4)
+                      << " | generic: " << generic_ms << " ms | specialized: " << specialized_ms << " ms"
+                      << " | 불일치: " << mismatch << "/" << bundles.size() << "\n";
+        }
+    }
+
+    // 검출기 전체 (two_row, 추적 없음): 커널 선택 외에는 같은 경로
+    const std::string saved_model = LANE_MODEL;
+    const std::string saved_kernel = LANE_KERNEL;
+    const bool saved_tracking = LANE_TRACKING;
+    LANE_MODEL = "two_row";
+    LANE_TRACKING = false;
+    std::vector<int> offsets[2];
+    const char* names[2] = {"generic", "specialized"};
+    for (int v = 0; v < 2; ++v) {
+        LANE_KERNEL = names[v];
+        LaneDetector detector;
+        DebugOverlay overlay;
+        double ms = measureMs(bundles, [&](const PreprocessedFrame& b) {
+            offsets[v].push_back(detector.process(b, overlay));
+        });
+        std::cout << "  LaneDetector::process (" << names[v] << ")" << std::fixed << std::setprecision(4)
+                  << " | " << ms << " ms\n";
+    }
+    long mismatch = 0;
+    for (size_t i = 0; i < offsets[0].size(); ++i) mismatch += offsets[0][i] != offsets[1][i];
+    std::cout << "    오프셋 불일치 프레임: " << mismatch << "/" << offsets[0].size() << "\n";
+    LANE_MODEL = saved_model;
+    LANE_KERNEL = saved_kernel;
+    LANE_TRACKING = saved_tracking;
+}
+
+// bird's-eye 변환: 테이블 생성 비용(1회) + 프레임당 마스크 remap 비용
+void benchBirdseye(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] bird's-eye remap (마스크 전용)\n";
+    auto bundles = preprocessFrames(source);
+
+    BirdseyeView birdseye;
+    auto start = std::chrono::steady_clock::now();
+    birdseye.rebuildIfNeeded(bundles.front().white_mask.size());
+    auto end = std::chrono::steady_clock::now();
+    double build_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    cv::Mat warped;
+    double warp_ms = measureMs(bundles, [&](const PreprocessedFrame& b) {
+        birdseye.warp(b.white_mask, warped, false);
+    });
+
+    std::cout << "  " << FRAME_WIDTH << "x" << FRAME_HEIGHT << std::fixed << std::setprecision(3)
+              << " | 테이블 생성: " << build_ms << " ms"
+              << " | 프레임당 remap: " << warp_ms << " ms\n";
+}
+
+// BGR 프레임을 BGGR Bayer 원본으로 되돌린 카메라 프레임 (캡처 크기)
+std::vector<CapturedFrame> mosaicFrames(const std::vector<cv::Mat>& source) {
+    auto frames = resizeFrames(source, cv::Size(CAMERA_CAPTURE_WIDTH, CAMERA_CAPTURE_HEIGHT));
+    std::vector<CapturedFrame> mosaics;
+    for (const auto& frame : frames) {
+        cv::Mat bayer(frame.size(), CV_8UC1);
+        for (int y = 0; y < frame.rows; ++y) {
+            const uchar* src = frame.ptr<uchar>(y);
+            uchar* dst = bayer.ptr<uchar>(y);
+            for (int x = 0; x < frame.cols; ++x) {
+                // BGGR: 짝수 행 B G, 홀수 행 G R
+                int channel = (y % 2 == 0) ? ((x % 2 == 0) ? 0 : 1) : ((x % 2 == 0) ? 1 : 2);
+                dst[x] = src[3 * x + channel];
+            }
+        }
+        CapturedFrame captured;
+        captured.image = bayer;
+        captured.fourcc = fourccFromString("BA81");
+        mosaics.push_back(captured);
+    }
+    return mosaics;
+}
+
+// 캡처 원본 -> 마스크: 전체 디모자이크 + 축소 + BGR 분류 vs Bayer 쿼드 직접 분류
+void benchBayer(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 캡처 원본 -> 마스크: demosaic+resize+lut vs bayer 쿼드 ("
+              << CAMERA_CAPTURE_WIDTH << "x" << CAMERA_CAPTURE_HEIGHT << " -> "
+              << FRAME_WIDTH << "x" << FRAME_HEIGHT << ")\n";
+    auto mosaics = mosaicFrames(source);
+    const cv::Size target(FRAME_WIDTH, FRAME_HEIGHT);
+    const std::string saved = COLOR_CLASSIFIER;
+    COLOR_CLASSIFIER = "lut";
+
+    FramePreprocessor bgr_preprocessor, bayer_preprocessor;
+    PreprocessedFrame a, b;
+    cv::Mat bgr, resized;
+    double bgr_ms = measureMs(mosaics, [&](const CapturedFrame& c) {
+        convertToBgr(c, bgr);
+        cv::resize(bgr, resized, target);
+        bgr_preprocessor.process(resized, a);
+    });
+    double bayer_ms = measureMs(mosaics, [&](const CapturedFrame& c) {
+        bayer_preprocessor.process(c, b);
+    });
+
+    // 두 경로의 클래스 이미지 일치율
+    long same = 0, total = 0;
+    for (const auto& c : mosaics) {
+        convertToBgr(c, bgr);
+        cv::resize(bgr, resized, target);
+        bgr_preprocessor.process(resized, a);
+        bayer_preprocessor.process(c, b);
+        cv::Mat diff;
+        cv::compare(a.grayscale, b.grayscale, diff, cv::CMP_EQ);
+        same += cv::countNonZero(diff);
+        total += static_cast<long>(diff.total());
+    }
+    COLOR_CLASSIFIER = saved;
+
+    std::cout << "  " << std::fixed << std::setprecision(3)
+              << "demosaic+resize+lut: " << bgr_ms << " ms"
+              << " | bayer: " << bayer_ms << " ms"
+              << " | 클래스 일치율: " << 100.0 * same / std::max(total, 1L) << " %\n";
+}
+
+// 디버그 표시 비용: 명령 기록만 (헤드리스 주행) vs 매 프레임 그리기 (뷰어)
+void benchOverlay(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 디버그 오버레이: 기록만 vs 기록 + render\n";
+    auto bundles = preprocessFrames(source);
+    const bool saved_viewer = VIEWER;
+    VIEWER = false; // 검출기 내부 imshow 제외
+
+    LaneDetector lane_detector;
+    ObjectDetector object_detector;
+    DebugOverlay lane_overlay, object_overlay;
+    cv::Mat lane_vis, object_vis;
+    std::vector<bool> flags;
+
+    double record_ms = measureMs(bundles, [&](const PreprocessedFrame& b) {
+        lane_detector.process(b, lane_overlay);
+        object_detector.process(b, object_overlay, flags);
+    });
+    double render_ms = measureMs(bundles, [&](const PreprocessedFrame& b) {
+        lane_detector.process(b, lane_overlay);
+        object_detector.process(b, object_overlay, flags);
+        lane_overlay.render(lane_vis);
+        object_overlay.render(object_vis);
+    });
+
+    std::cout << "  " << FRAME_WIDTH << "x" << FRAME_HEIGHT << std::fixed << std::setprecision(3)
+              << " | 기록만: " << record_ms << " ms"
+              << " | 기록 + render: " << render_ms << " ms\n";
+    VIEWER = saved_viewer;
+}
+
+// 정상 상태 프레임당 힙 할당 횟수 (채널 게시 + 전처리 + 차선 + 객체 검출, 뷰어 끔)
+// 한 바퀴 예열로 버퍼를 채운 뒤 두 번째 바퀴만 집계
+void benchAllocations(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 프레임당 힙 할당 (전처리 + 차선 + 객체)\n";
+    if (!allocCountEnabled()) {
+        std::cout << "  할당 집계 빌드가 아님 → make ALLOC_COUNT=1 로 빌드 후 실행\n";
+        return;
+    }
+
+    auto frames = resizeFrames(source, cv::Size(FRAME_WIDTH, FRAME_HEIGHT));
+    const bool saved_viewer = VIEWER;
+    VIEWER = false;
+
+    FramePreprocessor preprocessor;
+    FrameChannel channel(4);
+    FrameChannel::Ref ref;
+    LaneDetector lane_detector;
+    ObjectDetector object_detector;
+    DebugOverlay lane_overlay, object_overlay;
+    std::vector<bool> flags;
+    auto run = [&](const cv::Mat& frame) {
+        PreprocessedFrame* slot = channel.beginWrite();
+        if (!slot) return;
+        preprocessor.process(frame, *slot);
+        channel.publish();
+        if (!channel.latest(ref)) return;
+        lane_detector.process(*ref, lane_overlay);
+        object_detector.process(*ref, object_overlay, flags);
+        ref.reset();
+    };
+
+    for (const auto& frame : frames) run(frame);
+    size_t before = allocCount();
+    for (const auto& frame : frames) run(frame);
+    size_t total = allocCount() - before;
+
+    std::cout << "  " << FRAME_WIDTH << "x" << FRAME_HEIGHT << std::fixed << std::setprecision(3)
+              << " | 총 할당: " << total
+              << " | 프레임당: " << static_cast<double>(total) / frames.size() << "\n";
+    VIEWER = saved_viewer;
+}
+
+// 프레임당 검출 makespan: 한 스레드 순차 vs 기존 배치 (차선 | 객체) vs 작업 그래프 (네 검출 병렬)
+// 배치마다 별도 그래프(검출기 상태)로 같은 프레임 순서를 처리하므로 결과는 모두 같아야 함
+void benchExecutor(const std::vector<cv::Mat>& source) {
+    std::cout << "\n[BENCH] 프레임당 검출 makespan: serial vs split vs graph (작업자 "
+              << EXECUTOR_WORKERS << " + 호출 스레드)\n";
+    auto bundles = preprocessFrames(source);
+    const bool saved_viewer = VIEWER;
+    VIEWER = false;
+
+    TaskExecutor executor(EXECUTOR_WORKERS, "bench_worker");
+    const std::pair<PerceptionGraph::Layout, const char*> layouts[] = {
+        {PerceptionGraph::Layout::SERIAL, "serial"},
+        {PerceptionGraph::Layout::SPLIT, "split (차선 | 객체)"},
+        {PerceptionGraph::Layout::GRAPH, "graph (차선 | 정지선 | 횡단보도 | 출발선)"},
+    };
+
+    std::vector<LaneResult> reference_lane(bundles.size());
+    std::vector<ObjectResult> reference_object(bundles.size());
+    for (size_t l = 0; l < 3; ++l) {
+        PerceptionGraph graph(executor);
+        LaneResult lane;
+        ObjectResult object;
+        LatencyStats makespan(bundles.size());
+        long mismatch = 0;
+        for (size_t i = 0; i < bundles.size(); ++i) {
+            int64_t start = monotonicNs();
+            graph.run(bundles[i], i + 1, lane, object, layouts[l].first);
+            makespan.addSince(start);
+
+            if (l == 0) {
+                reference_lane[i] = lane;
+                reference_object[i] = object;
+            } else if (lane.offset != reference_lane[i].offset ||
+                       object.stop_line != reference_object[i].stop_line ||
+                       object.crosswalk != reference_object[i].crosswalk ||
+                       object.start_line != reference_object[i].start_line) {
+                ++mismatch;
+            }
+        }
+        makespan.report(std::string("makespan ") + layouts[l].second);
+        if (l > 0) std::cout << "    serial 대비 결과 불일치 프레임: " << mismatch << "\n";
+    }
+    VIEWER = saved_viewer;
+}
+
+// 자체 점검 항목 하나 (실패하면 내용 출력), 통과 여부 반환
+bool expectCheck(bool ok, const std::string& what) {
+    if (!ok) std::cout << "  [FAIL] " << what << "\n";
+    return ok;
+}
+
+// PCA9685 출력 자체 점검: FakeI2cBus 로 초기화 순서, 펄스 계산, 레지스터 묶음 기록, 중복 생략 확인
+// 기대값은 piracer 계산식 int(0xFFFF * pulse / 20ms) -> (duty + 1) >> 4 로 미리 계산한 값
+bool checkPca9685() {
+    std::cout << "\n[CHECK] PCA9685 출력 (FakeI2cBus)\n";
+    bool ok = true;
+
+    ok &= expectCheck(Pca9685Actuator::pulseCount(0.0f) == 307, "pulseCount(0.0) == 307 (1.5ms)");
+    ok &= expectCheck(Pca9685Actuator::pulseCount(1.0f) == 409, "pulseCount(1.0) == 409 (2.0ms)");
+    ok &= expectCheck(Pca9685Actuator::pulseCount(-1.0f) == 204, "pulseCount(-1.0) == 204 (1.0ms)");
+    ok &= expectCheck(Pca9685Actuator::pulseCount(3.0f) == 409, "pulseCount 범위 제한 (3.0 -> 1.0)");
+
+    auto bus = std::make_unique<FakeI2cBus>();
+    FakeI2cBus& fake = *bus;
+    Pca9685Actuator actuator(std::move(bus));
+    ok &= expectCheck(actuator.open(), "open()");
+
+    // 리셋 -> 슬립 -> 분주비(25MHz / 4096 / 50Hz = 122) -> 깨움 -> 재시작 + 자동 증가
+    const uint8_t init[5][2] = {{0x00, 0x00}, {0x00, 0x10}, {0xFE, 122}, {0x00, 0x00}, {0x00, 0xA0}};
+    ok &= expectCheck(fake.transactionCount() == 5, "초기화 트랜잭션 5개");
+    for (size_t i = 0; i < 5 && fake.transactionCount() == 5; ++i) {
+        const FakeI2cBus::Transaction& t = fake.recent(4 - i);
+        ok &= expectCheck(t.length == 2 && t.bytes[0] == init[i][0] && t.bytes[1] == init[i][1],
+                          "초기화 " + std::to_string(i) + "번째 쓰기");
+    }
+    ok &= expectCheck(fake.registers()[0x00] == 0xA0 && fake.registers()[0xFE] == 122, "MODE1 / PRESCALE 레지스터");
+
+    // 조향 0.5 -> 채널 0 은 부호 반전 pulseCount(-0.5) = 256, 스로틀 -0.25 -> 채널 1 = 281
+    ok &= expectCheck(actuator.set(0.5f, -0.25f), "set(0.5, -0.25)");
+    ok &= expectCheck(fake.transactionCount() == 6, "set() 한 번에 트랜잭션 1개");
+    const FakeI2cBus::Transaction& t = fake.recent(0);
+    const uint8_t leds[9] = {0x06, 0x00, 0x00, 256 & 0xFF, 256 >> 8, 0x00, 0x00, 281 & 0xFF, 281 >> 8};
+    ok &= expectCheck(t.length == 9 && std::equal(leds, leds + 9, t.bytes), "LED0/LED1 레지스터 9바이트 묶음");
+    ok &= expectCheck(std::equal(leds + 1, leds + 9, fake.registers() + 0x06), "자동 증가로 0x06 ~ 0x0D 반영");
+
+    // 같은 카운트가 되는 값은 쓰지 않음, 바뀌면 다시 씀
+    actuator.set(0.5f, -0.25f);
+    actuator.set(0.5001f, -0.25f);
+    ok &= expectCheck(fake.transactionCount() == 6, "카운트가 같으면 쓰기 생략");
+    actuator.set(0.0f, 1.0f);
+    ok &= expectCheck(fake.transactionCount() == 7 && fake.registers()[0x08] == (307 & 0xFF) &&
+                      fake.registers()[0x0C] == (409 & 0xFF) && fake.registers()[0x0D] == (409 >> 8),
+                      "값이 바뀌면 다시 기록");
+
+    std::cout << "  " << (ok ? "통과" : "실패") << "\n";
+    return ok;
+}
+
+// evdev 게임패드 자체 점검: FIFO 가짜 장치에 input_event 를 써 넣어 GamepadState 확인
+// - FIFO 는 EVIOCGABS 가 없어 축 범위 0 ~ 255 로 가정 (255 -> +1.0, 0 -> -1.0, y 축은 부호 반전)
+// - 한 번에 읽힌 보고 두 개가 따로 반환되는지, stop() 과 분리 후 재연결도 확인
+bool checkEvdevGamepad() {
+    std::cout << "\n[CHECK] evdev 게임패드 (FIFO 가짜 장치)\n";
+    char dir[] = "/tmp/gamepad_check_XXXXXX";
+    if (!mkdtemp(dir)) {
+        std::cout << "  [FAIL] 임시 디렉터리 생성 실패\n";
+        return false;
+    }
+    const std::string path = std::string(dir) + "/event";
+    bool ok = true;
+    int writer = -1;
+    auto makeDevice = [&]() {
+        if (writer >= 0) ::close(writer);
+        writer = -1;
+        return mkfifo(path.c_str(), 0600) == 0;
+    };
+    auto openWriter = [&]() {
+        writer = ::open(path.c_str(), O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+        return writer >= 0;
+    };
+    auto send = [&](uint16_t type, uint16_t code, int32_t value) {
+        input_event ev{};
+        ev.type = type;
+        ev.code = code;
+        ev.value = value;
+        return ::write(writer, &ev, sizeof(ev)) == static_cast<ssize_t>(sizeof(ev));
+    };
+
+    {
+        ok &= expectCheck(makeDevice(), "FIFO 생성");
+        EvdevGamepad pad(path);
+        ok &= expectCheck(pad.open() && openWriter(), "FIFO 열기");
+
+        // 보고 1: 왼쪽 스틱 오른쪽 끝, 오른쪽 스틱 위쪽 끝, A 누름
+        // 보고 2: 왼쪽 스틱 왼쪽 끝, 왼쪽 스틱 아래쪽 끝, A 뗌, B 누름 (두 보고를 한 번에 써서 한 read() 로 읽힘)
+        bool sent = send(EV_ABS, ABS_X, 255) && send(EV_ABS, ABS_RZ, 0) && send(EV_KEY, BTN_A, 1) &&
+                    send(EV_SYN, SYN_REPORT, 0) &&
+                    send(EV_ABS, ABS_X, 0) && send(EV_ABS, ABS_Y, 255) && send(EV_KEY, BTN_A, 0) &&
+                    send(EV_KEY, BTN_B, 1) && send(EV_SYN, SYN_REPORT, 0);
+        ok &= expectCheck(sent, "input_event 쓰기");
+
+        GamepadState state;
+        ok &= expectCheck(pad.waitReport(state) && state.left_x == 1.0f && state.right_y == 1.0f &&
+                          state.left_y == 0.0f && state.right_x == 0.0f && state.button_a && !state.button_b,
+                          "보고 1 (left_x +1, right_y +1, A)");
+        ok &= expectCheck(pad.waitReport(state) && state.left_x == -1.0f && state.left_y == -1.0f &&
+                          state.right_y == 1.0f && !state.button_a && state.button_b,
+                          "보고 2 (left_x -1, left_y -1, B, 이전 축 유지)");
+
+        // 분리 후 재연결: 장치를 다시 만들면 재시도 중에 열리고 입력 상태는 중립으로 초기화
+        ::unlink(path.c_str());
+        bool reconnected = false;
+        std::thread reconnect_thread([&]() { reconnected = pad.reconnect(); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(EvdevGamepad::RECONNECT_MIN_MS * 2));
+        ok &= expectCheck(makeDevice(), "FIFO 다시 생성");
+        reconnect_thread.join();
+        ok &= expectCheck(reconnected, "reconnect()");
+        sent = openWriter() && send(EV_KEY, BTN_A, 1) && send(EV_SYN, SYN_REPORT, 0);
+        ok &= expectCheck(sent && pad.waitReport(state) && state.button_a && !state.button_b && state.left_x == 0.0f,
+                          "재연결 후 보고 (중립 상태에서 A)");
+
+        // stop(): 대기 중인 waitReport() 와 reconnect() 가 바로 false
+        pad.stop();
+        ok &= expectCheck(!pad.waitReport(state), "stop() 후 waitReport() false");
+        ok &= expectCheck(!pad.reconnect(), "stop() 후 reconnect() false");
+    }
+
+    if (writer >= 0) ::close(writer);
+    ::unlink(path.c_str());
+    ::rmdir(dir);
+    std::cout << "  " << (ok ? "통과" : "실패") << "\n";
+    return ok;
+}
+
+// 프로세스 전체 CPU 사용 시간 (ms, 백엔드 내부 스레드 포함)
+double processCpuMs() {
+    timespec ts{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// 한 백엔드로 seconds 동안 프레임을 읽으며 통계 출력
+void benchCameraBackend(const std::string& backend, double seconds) {
+    const std::string saved = CAMERA_BACKEND;
+    CAMERA_BACKEND = backend;
+    USBCam cam;
+    bool opened = cam.init();
+    CAMERA_BACKEND = saved;
+    if (!opened) {
+        std::cout << "  " << backend << " | 열기 실패 → 건너뜀\n";
+        return;
+    }
+
+    CapturedFrame captured;
+    int frames = 0, aged = 0;
+    long dropped = 0;
+    uint32_t last_sequence = 0;
+    double read_sum = 0.0, read_max = 0.0, age_sum = 0.0, age_max = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    double cpu_start = processCpuMs();
+    while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < seconds) {
+        auto t0 = std::chrono::steady_clock::now();
+        if (!cam.read(captured)) continue;
+        auto t1 = std::chrono::steady_clock::now();
+
+        double read_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        read_sum += read_ms;
+        read_max = std::max(read_max, read_ms);
+
+        // 커널 캡처 시각부터 프레임이 손에 들어오기까지 걸린 시간
+        if (captured.timestamp_ns > 0) {
+            int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1.time_since_epoch()).count();
+            double age_ms = (now_ns - captured.timestamp_ns) / 1e6;
+            age_sum += age_ms;
+            age_max = std::max(age_max, age_ms);
+            if (aged > 0 && captured.sequence > last_sequence + 1) dropped += captured.sequence - last_sequence - 1;
+            last_sequence = captured.sequence;
+            ++aged;
+        }
+        ++frames;
+    }
+    double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    double cpu_ms = processCpuMs() - cpu_start;
+
+    std::cout << "  " << backend << std::fixed << std::setprecision(3)
+              << " | " << frames / (wall_ms / 1000.0) << " fps"
+              << " | read 평균/최대: " << (frames ? read_sum / frames : 0.0) << "/" << read_max << " ms";
+    if (aged > 0) {
+        std::cout << " | 캡처 후 경과 평균/최대: " << age_sum / aged << "/" << age_max << " ms"
+                  << " | 건너뛴 프레임: " << dropped;
+    } else {
+        std::cout << " | 캡처 시각 없음";
+    }
+    std::cout << " | CPU: " << 100.0 * cpu_ms / wall_ms << " %\n";
+}
+
+} // namespace
+
+int runCameraBenchmark(double seconds) {
+    std::cout << "\n[BENCH] 카메라 백엔드 (" << seconds << " 초씩)\n";
+    benchCameraBackend("gstreamer", seconds);
+    benchCameraBackend("v4l2", seconds);
+    if (!CAMERA_FAKE_FILE.empty()) benchCameraBackend("file", seconds);
+    return 0;
+}
+
+int runBenchmark(const std::string& video_path) {
+    std::vector<cv::Mat> frames;
+    if (!video_path.empty()) {
+        frames = loadFrames(video_path);
+    } else {
+        std::cout << "[INFO] 영상 경로 없음 → 합성 프레임 사용\n";
+        frames = makeSyntheticFrames(SYNTHETIC_FRAMES, cv::Size(640, 240));
+    }
+    if (frames.empty()) {
+        std::cerr << "[ERROR] 벤치마크 프레임이 없습니다." << std::endl;
+        return 1;
+    }
+    std::cout << "[INFO] 벤치마크 프레임 수: " << frames.size() << "\n";
+
+    benchColorClassifier(frames);
+    benchStartLine(frames);
+    benchLaneModel(frames);
+    benchLaneKernels(frames);
+    benchBirdseye(frames);
+    benchBayer(frames);
+    benchOverlay(frames);
+    benchAllocations(frames);
+    benchExecutor(frames);
+
+    // 하드웨어 없이 확인하는 출력/입력 자체 점검 (실패하면 종료 코드 1)
+    bool checks_ok = checkPca9685();
+    checks_ok &= checkEvdevGamepad();
+    return checks_ok ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include "birdseye_view.hpp"
+#include "constants.hpp"
+#include "config.hpp"
+#include <iostream>
+
+BirdseyeView::BirdseyeView() {}
+
+bool BirdseyeView::rebuildIfNeeded(cv::Size size) {
+    if (!map_.empty() && size == size_ && src_points_ == IPM_SRC_POINTS &&
+        dst_x1_ == IPM_DST_X1 && dst_x2_ == IPM_DST_X2 &&
+        cut_threshold_ == config().ROI_REMOVE_LEFT_X_THRESHOLD) {
+        return false;
+    }
+    // load_constants 에서 이미 거르지만, 테이블 없이 호출되면 한 번만 알리고 warp() 는 빈 마스크 출력
+    if (IPM_SRC_POINTS.size() != 8) {
+        if (!invalid_warned_) {
+            std::cerr << "[ERROR] IPM_SRC_POINTS 는 4개 점(8개 값)이어야 합니다." << std::endl;
+            invalid_warned_ = true;
+        }
+        return false;
+    }
+    buildMaps(size);
+    return true;
+}
+
+void BirdseyeView::buildMaps(cv::Size size) {
+    size_ = size;
+    src_points_ = IPM_SRC_POINTS;
+    dst_x1_ = IPM_DST_X1;
+    dst_x2_ = IPM_DST_X2;
+    cut_threshold_ = config().ROI_REMOVE_LEFT_X_THRESHOLD;
+
+    const float w = static_cast<float>(size.width);
+    const float h = static_cast<float>(size.height);
+    cv::Point2f src[4], dst[4];
+    for (int i = 0; i < 4; ++i) {
+        src[i] = cv::Point2f(src_points_[2 * i] * w, src_points_[2 * i + 1] * h);
+    }
+    dst[0] = cv::Point2f(dst_x1_ * w, 0.0f);
+    dst[1] = cv::Point2f(dst_x2_ * w, 0.0f);
+    dst[2] = cv::Point2f(dst_x2_ * w, h - 1.0f);
+    dst[3] = cv::Point2f(dst_x1_ * w, h - 1.0f);
+
+    // 출력 좌표 -> 원본 좌표 변환 행렬
+    cv::Mat m = cv::getPerspectiveTransform(dst, src);
+    const double m00 = m.at<double>(0, 0), m01 = m.at<double>(0, 1), m02 = m.at<double>(0, 2);
+    const double m10 = m.at<double>(1, 0), m11 = m.at<double>(1, 1), m12 = m.at<double>(1, 2);
+    const double m20 = m.at<double>(2, 0), m21 = m.at<double>(2, 1), m22 = m.at<double>(2, 2);
+
+    cv::Mat map_x(size, CV_32FC1), map_y(size, CV_32FC1), map_x_cut(size, CV_32FC1);
+    for (int v = 0; v < size.height; ++v) {
+        float* mx = map_x.ptr<float>(v);
+        float* my = map_y.ptr<float>(v);
+        float* mxc = map_x_cut.ptr<float>(v);
+        for (int u = 0; u < size.width; ++u) {
+            double z = m20 * u + m21 * v + m22;
+            double x = (m00 * u + m01 * v + m02) / z;
+            double y = (m10 * u + m11 * v + m12) / z;
+            mx[u] = static_cast<float>(x);
+            my[u] = static_cast<float>(y);
+            // 좌측 제거 영역은 범위 밖 좌표로 보내 테두리 값(0)이 되도록 함
+            mxc[u] = (cvRound(x) <= cut_threshold_) ? -1.0f : static_cast<float>(x);
+        }
+    }
+
+    cv::Mat unused;
+    cv::convertMaps(map_x, map_y, map_, unused, CV_16SC2, true);
+    cv::convertMaps(map_x_cut, map_y, map_cut_left_, unused, CV_16SC2, true);
+
+    std::cout << "[INFO] bird's-eye remap 테이블 생성 완료 (" << size.width << "x" << size.height << ")\n";
+}
+
+void BirdseyeView::warp(const cv::Mat& mask, cv::Mat& out, bool remove_left) const {
+    if (map_.empty()) {
+        out.create(mask.size(), CV_8UC1);
+        out.setTo(0);
+        return;
+    }
+    cv::remap(mask, out, remove_left ? map_cut_left_ : map_, cv::Mat(),
+              cv::INTER_NEAREST, cv::BORDER_CONSTANT, cv::Scalar(0));
+}
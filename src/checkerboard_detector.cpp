@@ -0,0 +1,67 @@
+#include "checkerboard_detector.hpp"
+#include "config.hpp"
+#include <algorithm>
+
+CheckerboardDetector::CheckerboardDetector() {}
+
+bool CheckerboardDetector::isRegularRun(int length) const {
+    return length >= min_run_ && length <= max_run_;
+}
+
+bool CheckerboardDetector::detect(const cv::Mat& roi) {
+    checker_rows_ = 0;
+    checker_cols_ = 0;
+    if (roi.empty()) return false;
+
+    const Config& cfg = config();
+    min_run_ = cfg.CHECKER_MIN_RUN;
+    max_run_ = cfg.CHECKER_MAX_RUN;
+
+    const int cols = roi.cols;
+    col_prev_.assign(cols, 0);
+    col_run_.assign(cols, 0);
+    col_chain_.assign(cols, 0);
+    col_best_.assign(cols, 0);
+
+    for (int y = 0; y < roi.rows; ++y) {
+        const uchar* row_ptr = roi.ptr<uchar>(y);
+
+        // 행 방향 run 분석
+        int run = 1, chain = 0, best = 0;
+        uchar prev = row_ptr[0] != 0;
+        for (int x = 1; x < cols; ++x) {
+            uchar v = row_ptr[x] != 0;
+            if (v == prev) { ++run; continue; }
+            chain = isRegularRun(run) ? chain + 1 : 0;
+            best = std::max(best, chain);
+            run = 1;
+            prev = v;
+        }
+        chain = isRegularRun(run) ? chain + 1 : 0;
+        best = std::max(best, chain);
+        if (best >= cfg.CHECKER_MIN_ALTERNATIONS) ++checker_rows_;
+
+        // 열 방향 run 상태 누적
+        for (int x = 0; x < cols; ++x) {
+            uchar v = row_ptr[x] != 0;
+            if (y == 0) {
+                col_prev_[x] = v;
+                col_run_[x] = 1;
+            } else if (v == col_prev_[x]) {
+                ++col_run_[x];
+            } else {
+                col_chain_[x] = isRegularRun(col_run_[x]) ? col_chain_[x] + 1 : 0;
+                col_best_[x] = std::max(col_best_[x], col_chain_[x]);
+                col_run_[x] = 1;
+                col_prev_[x] = v;
+            }
+        }
+    }
+
+    for (int x = 0; x < cols; ++x) {
+        int chain = isRegularRun(col_run_[x]) ? col_chain_[x] + 1 : 0;
+        if (std::max(col_best_[x], chain) >= cfg.CHECKER_MIN_ALTERNATIONS) ++checker_cols_;
+    }
+
+    return checker_rows_ >= cfg.CHECKER_MIN_LINES && checker_cols_ >= cfg.CHECKER_MIN_LINES;
+}
@@ -0,0 +1,176 @@
+#include "color_classifier.hpp"
+#include "config.hpp"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// OpenCV RGB2HSV_b 와 동일한 고정소수점 나눗셈 테이블
+constexpr int HSV_SHIFT = 12;
+
+struct HsvDivTables {
+    int sdiv[256];
+    int hdiv[256];
+    HsvDivTables() {
+        sdiv[0] = hdiv[0] = 0;
+        for (int i = 1; i < 256; ++i) {
+            sdiv[i] = static_cast<int>(std::lround((255 << HSV_SHIFT) / (1.0 * i)));
+            hdiv[i] = static_cast<int>(std::lround((180 << HSV_SHIFT) / (6.0 * i)));
+        }
+    }
+};
+
+const HsvDivTables& divTables() {
+    static const HsvDivTables tables;
+    return tables;
+}
+
+} // namespace
+
+ColorClassifier::ColorClassifier() {}
+
+void ColorClassifier::updateIfNeeded() {
+    const Config& cfg = config();
+    if (!lut_.empty() &&
+        white_s_max_ == cfg.WHITE_S_MAX && white_v_min_ == cfg.WHITE_V_MIN && valid_v_min_ == cfg.VALID_V_MIN &&
+        yellow_h_min_ == cfg.YELLOW_H_MIN && yellow_h_max_ == cfg.YELLOW_H_MAX) {
+        return;
+    }
+    white_s_max_ = cfg.WHITE_S_MAX;
+    white_v_min_ = cfg.WHITE_V_MIN;
+    valid_v_min_ = cfg.VALID_V_MIN;
+    yellow_h_min_ = cfg.YELLOW_H_MIN;
+    yellow_h_max_ = cfg.YELLOW_H_MAX;
+    buildTable();
+}
+
+uchar ColorClassifier::classifyPixel(int b, int g, int r) const {
+    const HsvDivTables& t = divTables();
+    int v = std::max(b, std::max(g, r));
+    if (v < valid_v_min_) return CLASS_NONE;
+
+    int diff = v - std::min(b, std::min(g, r));
+    int s = (diff * t.sdiv[v] + (1 << (HSV_SHIFT - 1))) >> HSV_SHIFT;
+    if (s < white_s_max_ && v >= white_v_min_) return CLASS_WHITE;
+
+    int h;
+    if (v == r)      h = g - b;
+    else if (v == g) h = b - r + 2 * diff;
+    else             h = r - g + 4 * diff;
+    h = (h * t.hdiv[diff] + (1 << (HSV_SHIFT - 1))) >> HSV_SHIFT;
+    if (h < 0) h += 180;
+
+    return (h >= yellow_h_min_ && h <= yellow_h_max_) ? CLASS_YELLOW : CLASS_NONE;
+}
+
+void ColorClassifier::buildTable() {
+    const int cells = 1 << QUANT_BITS;
+    const int span = 1 << QUANT_SHIFT;
+    lut_.assign(cells * cells * cells, CLASS_NONE);
+
+    int mixed = 0;
+    for (int bq = 0; bq < cells; ++bq) {
+        for (int gq = 0; gq < cells; ++gq) {
+            for (int rq = 0; rq < cells; ++rq) {
+                // 셀 내부 모든 색이 같은 클래스인지 확인
+                uchar first = classifyPixel(bq << QUANT_SHIFT, gq << QUANT_SHIFT, rq << QUANT_SHIFT);
+                bool uniform = true;
+                for (int db = 0; db < span && uniform; ++db)
+                    for (int dg = 0; dg < span && uniform; ++dg)
+                        for (int dr = 0; dr < span; ++dr) {
+                            uchar c = classifyPixel((bq << QUANT_SHIFT) + db,
+                                                    (gq << QUANT_SHIFT) + dg,
+                                                    (rq << QUANT_SHIFT) + dr);
+                            if (c != first) { uniform = false; break; }
+                        }
+                lut_[(bq << (2 * QUANT_BITS)) | (gq << QUANT_BITS) | rq] = uniform ? first : CLASS_MIXED;
+                if (!uniform) ++mixed;
+            }
+        }
+    }
+
+    std::cout << "[INFO] 색상 분류 LUT 생성 완료 (경계 셀 " << mixed << "/" << lut_.size() << ")\n";
+}
+
+void ColorClassifier::classify(const cv::Mat& bgr, const cv::Mat& roi_mask,
+                               cv::Mat& grayscale, cv::Mat& white_mask, cv::Mat& yellow_mask) {
+    updateIfNeeded();
+
+    grayscale.create(bgr.size(), CV_8UC1);
+    white_mask.create(bgr.size(), CV_8UC1);
+    yellow_mask.create(bgr.size(), CV_8UC1);
+
+    const uchar* lut = lut_.data();
+    for (int y = 0; y < bgr.rows; ++y) {
+        const uchar* src = bgr.ptr<uchar>(y);
+        const uchar* roi = roi_mask.ptr<uchar>(y);
+        uchar* gray = grayscale.ptr<uchar>(y);
+        uchar* white = white_mask.ptr<uchar>(y);
+        uchar* yellow = yellow_mask.ptr<uchar>(y);
+
+        for (int x = 0; x < bgr.cols; ++x, src += 3) {
+            int b = src[0], g = src[1], r = src[2];
+            uchar c = lut[((b >> QUANT_SHIFT) << (2 * QUANT_BITS)) | ((g >> QUANT_SHIFT) << QUANT_BITS) | (r >> QUANT_SHIFT)];
+            if (c == CLASS_MIXED) c = classifyPixel(b, g, r);
+            c &= roi[x]; // ROI 마스크는 0 또는 255
+
+            gray[x] = c;
+            white[x] = (c == CLASS_WHITE) ? 255 : 0;
+            yellow[x] = (c == CLASS_YELLOW) ? 255 : 0;
+        }
+    }
+}
+
+void ColorClassifier::classifyBayer(const cv::Mat& bayer, int red_x, int red_y, const cv::Mat& roi_mask, cv::Range rows,
+                                    cv::Mat& bgr, cv::Mat& grayscale, cv::Mat& white_mask, cv::Mat& yellow_mask) {
+    updateIfNeeded();
+
+    const cv::Size size = roi_mask.size();
+    bgr.create(size, CV_8UC3);
+    grayscale.create(size, CV_8UC1);
+    white_mask.create(size, CV_8UC1);
+    yellow_mask.create(size, CV_8UC1);
+
+    const int quads_w = bayer.cols / 2;
+    const int quads_h = bayer.rows / 2;
+
+    // 출력 열 -> 쿼드 열 변환표 (크기가 바뀔 때만 다시 계산)
+    if (static_cast<int>(quad_cols_.size()) != size.width || quad_src_cols_ != bayer.cols) {
+        quad_cols_.resize(size.width);
+        for (int x = 0; x < size.width; ++x) quad_cols_[x] = 2 * (x * quads_w / size.width);
+        quad_src_cols_ = bayer.cols;
+    }
+
+    const uchar* lut = lut_.data();
+    const int* quad_cols = quad_cols_.data();
+    const int blue_x = 1 - red_x;
+    for (int y = rows.start; y < rows.end; ++y) {
+        int qy = y * quads_h / size.height;
+        const uchar* red_row = bayer.ptr<uchar>(2 * qy + red_y);      // R, G 가 있는 행
+        const uchar* blue_row = bayer.ptr<uchar>(2 * qy + 1 - red_y); // B, G 가 있는 행
+        const uchar* roi = roi_mask.ptr<uchar>(y);
+        uchar* dst = bgr.ptr<uchar>(y);
+        uchar* gray = grayscale.ptr<uchar>(y);
+        uchar* white = white_mask.ptr<uchar>(y);
+        uchar* yellow = yellow_mask.ptr<uchar>(y);
+
+        for (int x = 0; x < size.width; ++x, dst += 3) {
+            int sx = quad_cols[x];
+            int r = red_row[sx + red_x];
+            int b = blue_row[sx + blue_x];
+            int g = (red_row[sx + blue_x] + blue_row[sx + red_x] + 1) >> 1;
+            dst[0] = static_cast<uchar>(b);
+            dst[1] = static_cast<uchar>(g);
+            dst[2] = static_cast<uchar>(r);
+
+            uchar c = lut[((b >> QUANT_SHIFT) << (2 * QUANT_BITS)) | ((g >> QUANT_SHIFT) << QUANT_BITS) | (r >> QUANT_SHIFT)];
+            if (c == CLASS_MIXED) c = classifyPixel(b, g, r);
+            c &= roi[x];
+
+            gray[x] = c;
+            white[x] = (c == CLASS_WHITE) ? 255 : 0;
+            yellow[x] = (c == CLASS_YELLOW) ? 255 : 0;
+        }
+    }
+}
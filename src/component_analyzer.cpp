@@ -0,0 +1,107 @@
+#include "component_analyzer.hpp"
+#include <algorithm>
+
+ComponentAnalyzer::ComponentAnalyzer() {}
+
+void ComponentAnalyzer::reserve(int rows, int cols) {
+    size_t max_runs = static_cast<size_t>(rows) * static_cast<size_t>((cols + 1) / 2);
+    runs_.reserve(max_runs);
+    parent_.reserve(max_runs);
+    component_of_.reserve(max_runs);
+    row_transitions_.reserve(max_runs);
+    last_row_.reserve(max_runs);
+    stats_.reserve(max_runs);
+}
+
+int ComponentAnalyzer::findRoot(int label) {
+    while (parent_[label] != label) {
+        parent_[label] = parent_[parent_[label]]; // 경로 압축
+        label = parent_[label];
+    }
+    return label;
+}
+
+void ComponentAnalyzer::unite(int a, int b) {
+    a = findRoot(a);
+    b = findRoot(b);
+    if (a == b) return;
+    // 먼저 등장한 run을 루트로 유지
+    if (a < b) parent_[b] = a;
+    else       parent_[a] = b;
+}
+
+const std::vector<ComponentStats>& ComponentAnalyzer::analyze(const cv::Mat& roi, uchar min_value) {
+    runs_.clear();
+    parent_.clear();
+    stats_.clear();
+
+    // 1) run 추출 + 윗행 run과 8-연결 병합
+    int prev_begin = 0, prev_end = 0;
+    for (int y = 0; y < roi.rows; ++y) {
+        const uchar* row_ptr = roi.ptr<uchar>(y);
+        int cur_begin = static_cast<int>(runs_.size());
+        int p = prev_begin;
+
+        int x = 0;
+        while (x < roi.cols) {
+            if (row_ptr[x] < min_value) { ++x; continue; }
+            int start = x;
+            while (x < roi.cols && row_ptr[x] >= min_value) ++x;
+            int end = x - 1;
+
+            int label = static_cast<int>(runs_.size());
+            runs_.push_back({y, start, end});
+            parent_.push_back(label);
+
+            // 대각선 이웃까지 포함: prev.start <= end + 1 && prev.end >= start - 1
+            while (p < prev_end && runs_[p].end < start - 1) ++p;
+            for (int q = p; q < prev_end && runs_[q].start <= end + 1; ++q) {
+                unite(label, q);
+            }
+        }
+
+        prev_begin = cur_begin;
+        prev_end = static_cast<int>(runs_.size());
+    }
+
+    // 2) run 목록으로 요소별 통계 집계
+    component_of_.assign(runs_.size(), -1);
+    row_transitions_.clear();
+    last_row_.clear();
+    const int last_col = roi.cols - 1;
+
+    for (size_t i = 0; i < runs_.size(); ++i) {
+        const Run& run = runs_[i];
+        int root = findRoot(static_cast<int>(i));
+        int c = component_of_[root];
+        if (c < 0) {
+            c = component_of_[root] = static_cast<int>(stats_.size());
+            ComponentStats s;
+            s.left = run.start;
+            s.right = run.end;
+            s.top = s.bottom = run.row;
+            stats_.push_back(s);
+            row_transitions_.push_back(0);
+            last_row_.push_back(run.row);
+        }
+
+        ComponentStats& s = stats_[c];
+        s.area += run.end - run.start + 1;
+        s.left = std::min(s.left, run.start);
+        s.right = std::max(s.right, run.end);
+        s.bottom = run.row;
+
+        // 행이 바뀌면 직전 행의 전이 횟수로 최대값 갱신
+        if (last_row_[c] != run.row) {
+            s.max_transitions = std::max(s.max_transitions, row_transitions_[c]);
+            row_transitions_[c] = 0;
+            last_row_[c] = run.row;
+        }
+        row_transitions_[c] += (run.start > 0) + (run.end < last_col);
+    }
+
+    for (size_t c = 0; c < stats_.size(); ++c) {
+        stats_[c].max_transitions = std::max(stats_[c].max_transitions, row_transitions_[c]);
+    }
+    return stats_;
+}
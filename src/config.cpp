@@ -0,0 +1,115 @@
+#include "config.hpp"
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+namespace {
+ConfigPtr g_config;                    // std::atomic_load/atomic_store 로만 접근
+std::atomic<uint64_t> g_version{0};
+
+thread_local ConfigPtr t_pinned;       // pinConfig() 로 고정한 Config (수명 유지)
+thread_local const Config* t_active = nullptr;
+
+std::shared_ptr<Config> parseConfig(const nlohmann::json& j) {
+    auto config = std::make_shared<Config>();
+    config->WHITE_S_MAX = j["WHITE_S_MAX"];
+    config->WHITE_V_MIN = j["WHITE_V_MIN"];
+    config->VALID_V_MIN = j["VALID_V_MIN"];
+    config->YELLOW_H_MIN = j["YELLOW_H_MIN"];
+    config->YELLOW_H_MAX = j["YELLOW_H_MAX"];
+    config->ROI_REMOVE_LEFT_X_THRESHOLD = j["ROI_REMOVE_LEFT_X_THRESHOLD"];
+    config->DEFAULT_LANE_GAP = j["DEFAULT_LANE_GAP"];
+    config->AVG_PARAM = j["AVG_PARAM"];
+    config->INTER_PARAM = j["INTER_PARAM"];
+    config->LANE_TRACK_WINDOW = j["LANE_TRACK_WINDOW"];
+    config->LANE_TRACK_MAX_MISSES = j["LANE_TRACK_MAX_MISSES"];
+    config->YELLOW_PIXEL_THRESHOLD = j["YELLOW_PIXEL_THRESHOLD"];
+    config->STOPLINE_DETECTION_THRESHOLD = j["STOPLINE_DETECTION_THRESHOLD"];
+    config->CROSSWALK_DETECTION_RECT_HEIGHT_THRESHOLD = j["CROSSWALK_DETECTION_RECT_HEIGHT_THRESHOLD"];
+    config->CROSSWALK_DETECTION_RECT_WIDTH_THRESHOLD = j["CROSSWALK_DETECTION_RECT_WIDTH_THRESHOLD"];
+    config->CROSSWALK_DETECTION_RECT_COUNT_THRESHOLD = j["CROSSWALK_DETECTION_RECT_COUNT_THRESHOLD"];
+    config->STARTLINE_DETECTION_THRESHOLD = j["STARTLINE_DETECTION_THRESHOLD"];
+    config->GFT_CORNER_QUALITY_LEVEL = j["GFT_CORNER_QUALITY_LEVEL"];
+    config->GFT_MIN_CORNER_DISTANCE = j["GFT_MIN_CORNER_DISTANCE"];
+    config->CHECKER_MIN_RUN = j["CHECKER_MIN_RUN"];
+    config->CHECKER_MAX_RUN = j["CHECKER_MAX_RUN"];
+    config->CHECKER_MIN_ALTERNATIONS = j["CHECKER_MIN_ALTERNATIONS"];
+    config->CHECKER_MIN_LINES = j["CHECKER_MIN_LINES"];
+    config->WAIT_SECONDS = j["WAIT_SECONDS"];
+    config->ROI_REMOVE_LEFT = j["ROI_REMOVE_LEFT"];
+    config->WHITE_LINE_DRIVE = j["WHITE_LINE_DRIVE"];
+    config->STEERING_OFFSET = j["STEERING_OFFSET"];
+    config->STEERING_OFFSET_2 = j["STEERING_OFFSET_2"];
+    config->STEERING_KP = j["STEERING_KP"];
+    config->STEERING_KI = j["STEERING_KI"];
+    config->STEERING_KD = j["STEERING_KD"];
+    config->STEERING_I_LIMIT = j["STEERING_I_LIMIT"];
+    config->STEERING_D_FILTER = j["STEERING_D_FILTER"];
+    config->STEERING_KFF_HEADING = j["STEERING_KFF_HEADING"];
+    config->STEERING_KFF_CURVATURE = j["STEERING_KFF_CURVATURE"];
+    config->STEERING_LATENCY_COMP = j["STEERING_LATENCY_COMP"];
+    config->STEERING_ACTUATION_DELAY_MS = j["STEERING_ACTUATION_DELAY_MS"];
+    config->STEERING_LATENCY_MAX_MS = j["STEERING_LATENCY_MAX_MS"];
+    config->THROTTLE_KP = j["THROTTLE_KP"];
+    config->MAX_THROTTLE = j["MAX_THROTTLE"];
+    config->BASE_THROTTLE = j["BASE_THROTTLE"];
+    config->THROTTLE_SCHEDULING = j["THROTTLE_SCHEDULING"];
+    config->THROTTLE_HEADING_GAIN = j["THROTTLE_HEADING_GAIN"];
+    config->THROTTLE_CURVATURE_GAIN = j["THROTTLE_CURVATURE_GAIN"];
+    config->ADAPTIVE_DETECTORS = j["ADAPTIVE_DETECTORS"];
+    config->DETECTOR_IDLE_DECIMATION = j["DETECTOR_IDLE_DECIMATION"];
+    return config;
+}
+}
+
+ConfigPtr currentConfig() {
+    return std::atomic_load_explicit(&g_config, std::memory_order_acquire);
+}
+
+uint64_t publishConfig(std::shared_ptr<Config> config) {
+    config->version = g_version.fetch_add(1, std::memory_order_relaxed) + 1;
+    const uint64_t version = config->version;
+    std::atomic_store_explicit(&g_config, ConfigPtr(std::move(config)), std::memory_order_release);
+    return version;
+}
+
+bool reloadConfig(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[WARN] 설정 파일 열기 실패: " << path << std::endl;
+        return false;
+    }
+    std::shared_ptr<Config> config;
+    try {
+        nlohmann::json j;
+        file >> j;
+        config = parseConfig(j);
+    } catch (const std::exception& e) {
+        std::cerr << "[WARN] 설정 파일 해석 실패, 기존 설정 유지: " << e.what() << std::endl;
+        return false;
+    }
+    const uint64_t version = publishConfig(std::move(config));
+    std::cout << "[INFO] 설정 v" << version << " 게시 (" << path << ")" << std::endl;
+    return true;
+}
+
+const Config& pinConfig() {
+    t_pinned = currentConfig();
+    if (!t_pinned) t_pinned = std::make_shared<const Config>();
+    t_active = t_pinned.get();
+    return *t_active;
+}
+
+const Config& config() {
+    if (!t_active) return pinConfig();
+    return *t_active;
+}
+
+ConfigScope::ConfigScope(const Config& config) : previous_(t_active) {
+    t_active = &config;
+}
+
+ConfigScope::~ConfigScope() {
+    t_active = previous_;
+}
@@ -0,0 +1,71 @@
+#include "config_watcher.hpp"
+#include "config.hpp"
+#include "thread_profile.hpp"
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+ConfigWatcher::ConfigWatcher(const std::string& path) : path_(path) {
+    const size_t slash = path.find_last_of('/');
+    directory_ = slash == std::string::npos ? "." : path.substr(0, slash);
+    filename_ = slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    stop();
+    if (inotify_fd_ >= 0) ::close(inotify_fd_);
+    if (wake_fd_ >= 0) ::close(wake_fd_);
+}
+
+bool ConfigWatcher::start() {
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (inotify_fd_ < 0 || wake_fd_ < 0) {
+        std::cerr << "[WARN] 설정 감시 초기화 실패: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    if (inotify_add_watch(inotify_fd_, directory_.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        std::cerr << "[WARN] 설정 감시 등록 실패: " << directory_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return false;
+    }
+    thread_ = std::thread(&ConfigWatcher::run, this);
+    std::cout << "[INFO] 설정 파일 감시 시작: " << path_ << std::endl;
+    return true;
+}
+
+void ConfigWatcher::stop() {
+    if (!thread_.joinable()) return;
+    const uint64_t one = 1;
+    ssize_t written = ::write(wake_fd_, &one, sizeof(one));
+    (void)written;
+    thread_.join();
+}
+
+void ConfigWatcher::run() {
+    applyThreadProfile("config");
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        pollfd fds[2] = {{inotify_fd_, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        if (fds[1].revents) return;
+
+        bool changed = false;
+        ssize_t n;
+        while ((n = ::read(inotify_fd_, buffer, sizeof(buffer))) > 0) {
+            for (char* p = buffer; p < buffer + n;) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(p);
+                if (event->len > 0 && filename_ == event->name) changed = true;
+                p += sizeof(inotify_event) + event->len;
+            }
+        }
+        if (changed) reloadConfig(path_);
+    }
+}
@@ -1,4 +1,5 @@
 #include "constants.hpp"
+#include "config.hpp"
 #include <fstream>
 #include <iostream>
 #include <nlohmann/json.hpp>
@@ -8,17 +9,7 @@ int FRAME_WIDTH;
 int FRAME_HEIGHT;
 int ROI_Y_START;
 int ROI_Y_END;
-int WHITE_S_MAX;
-int WHITE_V_MIN;
-int VALID_V_MIN;
-int YELLOW_H_MIN;
-int YELLOW_H_MAX;
 bool VIEWER;
-float STEERING_KP;
-float THROTTLE_KP;
-float MAX_THROTTLE;
-float BASE_THROTTLE;
-int WAIT_SECONDS;
 int RED_H_MIN1;
 int RED_H_MIN2;
 int RED_H_MAX1;
@@ -28,33 +19,58 @@ int RED_V_MIN;
 int Y_TOP;
 int LONG_HALF;
 int SHORT_HALF;
-bool ROI_REMOVE_LEFT;
-int ROI_REMOVE_LEFT_X_THRESHOLD;
-bool WHITE_LINE_DRIVE;
-int YELLOW_PIXEL_THRESHOLD;
-int DEFAULT_LANE_GAP;
 float STOPLINE_DETECTION_Y1;
 float STOPLINE_DETECTION_Y2;
-float STOPLINE_DETECTION_THRESHOLD;
-float AVG_PARAM;
-float INTER_PARAM;
 float CROSSWALK_DETECTION_X1;
 float CROSSWALK_DETECTION_X2;
 float CROSSWALK_DETECTION_Y1;
 float CROSSWALK_DETECTION_Y2;
-int CROSSWALK_DETECTION_RECT_HEIGHT_THRESHOLD;
-int CROSSWALK_DETECTION_RECT_WIDTH_THRESHOLD;
-int CROSSWALK_DETECTION_RECT_COUNT_THRESHOLD;
 float STARTLINE_DETECTION_X1;
 float STARTLINE_DETECTION_X2;
 float STARTLINE_DETECTION_Y1;
 float STARTLINE_DETECTION_Y2;
-int STARTLINE_DETECTION_THRESHOLD;
 int GFT_MAX_CORNER_QUANTITY;
-float GFT_CORNER_QUALITY_LEVEL;
-int GFT_MIN_CORNER_DISTANCE;
-float STEERING_OFFSET;
-float STEERING_OFFSET_2;
+std::string COLOR_CLASSIFIER;
+std::string STARTLINE_DETECTOR;
+bool LANE_TRACKING;
+std::string LANE_MODEL;
+int LANE_FIT_ROWS;
+int LANE_FIT_ORDER;
+float LANE_FIT_Y1;
+float LANE_FIT_Y2;
+bool IPM_ENABLE;
+std::vector<float> IPM_SRC_POINTS;
+float IPM_DST_X1;
+float IPM_DST_X2;
+int IPM_LANE_GAP;
+std::string CAMERA_BACKEND;
+std::string CAMERA_DEVICE;
+int CAMERA_CAPTURE_WIDTH;
+int CAMERA_CAPTURE_HEIGHT;
+std::string CAMERA_PIXEL_FORMAT;
+int CAMERA_BUFFER_COUNT;
+int CAMERA_FPS;
+std::string CAMERA_FAKE_FILE;
+std::string PERCEPTION_INPUT;
+std::string CAPTURE_CROP;
+int PIPELINE_POLL_MS;
+std::string JOIN_POLICY;
+int JOIN_TIMEOUT_MS;
+std::map<std::string, std::vector<int>> THREAD_PROFILE;
+bool MEMORY_LOCK;
+int PREFAULT_HEAP_MB;
+int EXECUTOR_WORKERS;
+std::string ACTUATOR_BACKEND;
+std::string ACTUATOR_I2C_DEVICE;
+int ACTUATOR_I2C_ADDRESS;
+std::string GAMEPAD_BACKEND;
+std::string GAMEPAD_DEVICE;
+bool ACTUATOR_ASYNC;
+float ACTUATOR_EPSILON;
+int CONTROL_RATE_HZ;
+int CONTROL_EXTRAPOLATE_MAX_MS;
+bool CONFIG_HOT_RELOAD;
+std::string LANE_KERNEL;
 
 void load_constants(const std::string& path) {
     std::ifstream file(path);
@@ -69,17 +85,7 @@ void load_constants(const std::string& path) {
     FRAME_HEIGHT = j["FRAME_HEIGHT"];
     ROI_Y_START = j["ROI_Y_START"];
     ROI_Y_END = j["ROI_Y_END"];
-    WHITE_S_MAX = j["WHITE_S_MAX"];
-    WHITE_V_MIN = j["WHITE_V_MIN"];
-    VALID_V_MIN = j["VALID_V_MIN"];
-    YELLOW_H_MIN = j["YELLOW_H_MIN"];
-    YELLOW_H_MAX = j["YELLOW_H_MAX"];
     VIEWER = j["VIEWER"];
-    STEERING_KP = j["STEERING_KP"];
-    THROTTLE_KP = j["THROTTLE_KP"];
-    MAX_THROTTLE = j["MAX_THROTTLE"];
-    BASE_THROTTLE = j["BASE_THROTTLE"];
-    WAIT_SECONDS = j["WAIT_SECONDS"];
     RED_H_MIN1= j["RED_H_MIN1"];
     RED_H_MIN2= j["RED_H_MIN2"];
     RED_H_MAX1= j["RED_H_MAX1"];
@@ -89,31 +95,64 @@ void load_constants(const std::string& path) {
     Y_TOP= j["Y_TOP"];
     LONG_HALF= j["LONG_HALF"];
     SHORT_HALF= j["SHORT_HALF"];
-    ROI_REMOVE_LEFT= j["ROI_REMOVE_LEFT"];
-    ROI_REMOVE_LEFT_X_THRESHOLD= j["ROI_REMOVE_LEFT_X_THRESHOLD"];
-    WHITE_LINE_DRIVE = j["WHITE_LINE_DRIVE"];
-    YELLOW_PIXEL_THRESHOLD = j["YELLOW_PIXEL_THRESHOLD"];
-    DEFAULT_LANE_GAP = j["DEFAULT_LANE_GAP"];
     STOPLINE_DETECTION_Y1 = j["STOPLINE_DETECTION_Y1"];
     STOPLINE_DETECTION_Y2 = j["STOPLINE_DETECTION_Y2"];
-    STOPLINE_DETECTION_THRESHOLD = j["STOPLINE_DETECTION_THRESHOLD"];
-    AVG_PARAM = j["AVG_PARAM"];
-    INTER_PARAM = j["INTER_PARAM"];
     CROSSWALK_DETECTION_X1 = j["CROSSWALK_DETECTION_X1"];
     CROSSWALK_DETECTION_X2 = j["CROSSWALK_DETECTION_X2"];
     CROSSWALK_DETECTION_Y1 = j["CROSSWALK_DETECTION_Y1"];
     CROSSWALK_DETECTION_Y2 = j["CROSSWALK_DETECTION_Y2"];
-    CROSSWALK_DETECTION_RECT_HEIGHT_THRESHOLD = j["CROSSWALK_DETECTION_RECT_HEIGHT_THRESHOLD"];
-    CROSSWALK_DETECTION_RECT_WIDTH_THRESHOLD =  j["CROSSWALK_DETECTION_RECT_WIDTH_THRESHOLD"];
-    CROSSWALK_DETECTION_RECT_COUNT_THRESHOLD = j["CROSSWALK_DETECTION_RECT_COUNT_THRESHOLD"];
     STARTLINE_DETECTION_X1 = j["STARTLINE_DETECTION_X1"];
     STARTLINE_DETECTION_X2 = j["STARTLINE_DETECTION_X2"];
     STARTLINE_DETECTION_Y1 = j["STARTLINE_DETECTION_Y1"];
     STARTLINE_DETECTION_Y2 = j["STARTLINE_DETECTION_Y2"];
-    STARTLINE_DETECTION_THRESHOLD = j["STARTLINE_DETECTION_THRESHOLD"];
     GFT_MAX_CORNER_QUANTITY = j["GFT_MAX_CORNER_QUANTITY"];
-    GFT_CORNER_QUALITY_LEVEL = j["GFT_CORNER_QUALITY_LEVEL"];
-    GFT_MIN_CORNER_DISTANCE = j["GFT_MIN_CORNER_DISTANCE"];
-    STEERING_OFFSET = j["STEERING_OFFSET"];
-    STEERING_OFFSET_2 = j["STEERING_OFFSET_2"];
+    COLOR_CLASSIFIER = j["COLOR_CLASSIFIER"].get<std::string>();
+    STARTLINE_DETECTOR = j["STARTLINE_DETECTOR"].get<std::string>();
+    LANE_TRACKING = j["LANE_TRACKING"];
+    LANE_MODEL = j["LANE_MODEL"].get<std::string>();
+    LANE_FIT_ROWS = j["LANE_FIT_ROWS"];
+    LANE_FIT_ORDER = j["LANE_FIT_ORDER"];
+    LANE_FIT_Y1 = j["LANE_FIT_Y1"];
+    LANE_FIT_Y2 = j["LANE_FIT_Y2"];
+    IPM_ENABLE = j["IPM_ENABLE"];
+    IPM_SRC_POINTS = j["IPM_SRC_POINTS"].get<std::vector<float>>();
+    if (IPM_SRC_POINTS.size() != 8) {
+        throw std::runtime_error("IPM_SRC_POINTS 는 4개 점(8개 값)이어야 합니다");
+    }
+    IPM_DST_X1 = j["IPM_DST_X1"];
+    IPM_DST_X2 = j["IPM_DST_X2"];
+    IPM_LANE_GAP = j["IPM_LANE_GAP"];
+    CAMERA_BACKEND = j["CAMERA_BACKEND"].get<std::string>();
+    CAMERA_DEVICE = j["CAMERA_DEVICE"].get<std::string>();
+    CAMERA_CAPTURE_WIDTH = j["CAMERA_CAPTURE_WIDTH"];
+    CAMERA_CAPTURE_HEIGHT = j["CAMERA_CAPTURE_HEIGHT"];
+    CAMERA_PIXEL_FORMAT = j["CAMERA_PIXEL_FORMAT"].get<std::string>();
+    CAMERA_BUFFER_COUNT = j["CAMERA_BUFFER_COUNT"];
+    CAMERA_FPS = j["CAMERA_FPS"];
+    CAMERA_FAKE_FILE = j["CAMERA_FAKE_FILE"].get<std::string>();
+    PERCEPTION_INPUT = j["PERCEPTION_INPUT"].get<std::string>();
+    CAPTURE_CROP = j["CAPTURE_CROP"].get<std::string>();
+    PIPELINE_POLL_MS = j["PIPELINE_POLL_MS"];
+    JOIN_POLICY = j["JOIN_POLICY"].get<std::string>();
+    JOIN_TIMEOUT_MS = j["JOIN_TIMEOUT_MS"];
+    THREAD_PROFILE = j["THREAD_PROFILE"].get<std::map<std::string, std::vector<int>>>();
+    MEMORY_LOCK = j["MEMORY_LOCK"];
+    PREFAULT_HEAP_MB = j["PREFAULT_HEAP_MB"];
+    EXECUTOR_WORKERS = j["EXECUTOR_WORKERS"];
+    ACTUATOR_BACKEND = j["ACTUATOR_BACKEND"].get<std::string>();
+    ACTUATOR_I2C_DEVICE = j["ACTUATOR_I2C_DEVICE"].get<std::string>();
+    ACTUATOR_I2C_ADDRESS = j["ACTUATOR_I2C_ADDRESS"];
+    GAMEPAD_BACKEND = j["GAMEPAD_BACKEND"].get<std::string>();
+    GAMEPAD_DEVICE = j["GAMEPAD_DEVICE"].get<std::string>();
+    ACTUATOR_ASYNC = j["ACTUATOR_ASYNC"];
+    ACTUATOR_EPSILON = j["ACTUATOR_EPSILON"];
+    CONTROL_RATE_HZ = j["CONTROL_RATE_HZ"];
+    CONTROL_EXTRAPOLATE_MAX_MS = j["CONTROL_EXTRAPOLATE_MAX_MS"];
+    CONFIG_HOT_RELOAD = j["CONFIG_HOT_RELOAD"];
+    LANE_KERNEL = j["LANE_KERNEL"].get<std::string>();
+
+    // 실행 중 바꿀 수 있는 튜닝 값은 Config 로 게시
+    if (!reloadConfig(path)) {
+        throw std::runtime_error("constants.json 튜닝 값 해석 실패");
+    }
 }
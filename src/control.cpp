@@ -1,6 +1,12 @@
 // control.cpp
 #include "control.hpp"
 #include "constants.hpp"
+#include "config.hpp"
+#include "thread_profile.hpp"
+#include "pca9685_actuator.hpp"
+#include "async_actuator.hpp"
+#include "latency_stats.hpp"
+#include "evdev_gamepad.hpp"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
@@ -11,17 +17,60 @@
 namespace py = pybind11;  // pybind11 네임스페이스 별칭
 using namespace std::chrono;  // 시간 관련 유틸 사용
 
-// 전역 상태 변수들
-bool crosswalk_flag = false;               // 횡단보도 감지 플래그 (한 번만 처리)
-bool crosswalk_ignore_stopline = false;    // 횡단보도 후 정지선 무시 여부
-steady_clock::time_point crosswalk_resume_time;  // 정지선 무시 기간 시작 시간 저장
-
 // Python 객체(piracer, gamepad)를 감싸는 내부 구현 구조체
 struct __attribute__((visibility("hidden"))) Controller::Impl {
-    py::object piracer_;   // PiRacerPro Python 객체
     py::object gamepad_;   // ShanWanGamepad Python 객체
+    std::unique_ptr<py::gil_scoped_release> gil_release_;  // 초기화 후 GIL 을 놓아 게임패드 스레드가 쓰게 함
+};
+
+namespace {
+
+// 기존 piracer 파이썬 패키지로 출력 (호출마다 GIL 획득 + 파이썬 호출 2회)
+class __attribute__((visibility("hidden"))) PythonActuator : public Actuator {
+public:
+    explicit PythonActuator(py::object piracer) : piracer_(std::move(piracer)) {}
+    ~PythonActuator() override {
+        py::gil_scoped_acquire gil;
+        piracer_ = py::object();
+    }
+
+    bool open() override { return static_cast<bool>(piracer_); }
+    bool set(float steering, float throttle) override {
+        try {
+            py::gil_scoped_acquire gil;
+            piracer_.attr("set_steering_percent")(steering);
+            piracer_.attr("set_throttle_percent")(throttle);
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "[ERROR] Python 제어 실패: " << e.what() << "\n";
+            return false;
+        }
+    }
+    const char* name() const override { return "python"; }
+
+private:
+    py::object piracer_;
 };
 
+// ACTUATOR_BACKEND: "python" | "pca9685" (/dev/i2c-N 직접) | "fake" (레지스터 기록만)
+// ACTUATOR_ASYNC 이면 전용 스레드에서 출력 (update() 는 명령 저장만)
+std::unique_ptr<Actuator> createActuator() {
+    std::unique_ptr<Actuator> actuator;
+    if (ACTUATOR_BACKEND == "pca9685") {
+        actuator = std::make_unique<Pca9685Actuator>(
+            std::make_unique<LinuxI2cBus>(ACTUATOR_I2C_DEVICE, ACTUATOR_I2C_ADDRESS));
+    } else if (ACTUATOR_BACKEND == "fake") {
+        actuator = std::make_unique<Pca9685Actuator>(std::make_unique<FakeI2cBus>());
+    } else {
+        auto piracer_module = py::module_::import("piracer.vehicles");
+        actuator = std::make_unique<PythonActuator>(piracer_module.attr("PiRacerPro")());
+    }
+    if (ACTUATOR_ASYNC) return std::make_unique<AsyncActuator>(std::move(actuator), ACTUATOR_EPSILON);
+    return actuator;
+}
+
+} // namespace
+
 // 생성자: Python 인터프리터 초기화 및 객체 생성, 게임패드 스레드 시작
 Controller::Controller()
     : drive_state_(DriveState::DRIVE),   // 초기 주행 상태 설정
@@ -32,22 +81,41 @@ Controller::Controller()
       manual_throttle_(0.0f),            // 수동 입력용 스로틀
       manual_steering_(0.0f),            // 수동 입력용 스티어링
       gamepad_running_(false),           // 게임패드 스레드 실행 플래그 초기화
-      last_manual_mode_(true)            // 자동 -> 수동 변경시 리셋
+      last_manual_mode_(true),           // 자동 -> 수동 변경시 리셋
+      roi_remove_left_(config().ROI_REMOVE_LEFT),   // 차선 검출 주행 모드 시작 값
+      white_line_drive_(config().WHITE_LINE_DRIVE)
 
 {
     try {
         // Python 인터프리터 시작
         py::initialize_interpreter();
 
-        // PiRacerPro 객체 생성 (파이썬 모듈 piracer.vehicles에서 가져옴)
-        auto piracer_module = py::module_::import("piracer.vehicles");
-        impl_->piracer_ = piracer_module.attr("PiRacerPro")();
+        // 조향/스로틀 출력 백엔드 (python 이면 piracer.vehicles 의 PiRacerPro 객체 생성)
+        actuator_ = createActuator();
+        if (!actuator_->open()) {
+            std::cerr << "[ERROR] 액추에이터 초기화 실패 (" << actuator_->name() << ")\n";
+            actuator_.reset();
+        }
 
-        // ShanWanGamepad 객체 생성 (파이썬 모듈 piracer.gamepads에서 가져옴)
-        auto gamepad_module = py::module_::import("piracer.gamepads");
-        impl_->gamepad_ = gamepad_module.attr("ShanWanGamepad")();
+        // 게임패드 입력 (GAMEPAD_BACKEND: "evdev" | "python", evdev 장치가 없으면 python 으로 대체)
+        if (GAMEPAD_BACKEND == "evdev") {
+            evdev_gamepad_ = std::make_unique<EvdevGamepad>(GAMEPAD_DEVICE);
+            if (!evdev_gamepad_->open()) {
+                std::cerr << "[WARN] evdev 게임패드 사용 불가 -> ShanWanGamepad(python) 사용\n";
+                evdev_gamepad_.reset();
+            }
+        }
+        if (!evdev_gamepad_) {
+            // ShanWanGamepad 객체 생성 (파이썬 모듈 piracer.gamepads에서 가져옴)
+            auto gamepad_module = py::module_::import("piracer.gamepads");
+            impl_->gamepad_ = gamepad_module.attr("ShanWanGamepad")();
+        }
+
+        std::cout << "[INFO] 액추에이터(" << ACTUATOR_BACKEND << ") 및 게임패드("
+                  << (evdev_gamepad_ ? "evdev" : "python") << ") 생성 완료\n";
 
-        std::cout << "[INFO] Python PiracerPro 및 ShanWanGamepad 생성 완료\n";
+        // 이후 파이썬 호출은 각 호출 지점에서 GIL 을 획득
+        impl_->gil_release_ = std::make_unique<py::gil_scoped_release>();
 
         // 별도 스레드에서 게임패드 입력 처리 시작
         startGamepadThread();
@@ -61,21 +129,22 @@ Controller::Controller()
 Controller::~Controller() {
     // 게임패드 스레드 종료 요청
     gamepad_running_ = false;
+    if (evdev_gamepad_) evdev_gamepad_->stop();  // poll 대기 중인 스레드 깨움
     if (gamepad_thread_.joinable()) {
         gamepad_thread_.join();  // 스레드가 끝날 때까지 대기
     }
 
-    // 모터를 완전히 중지시켜 안전 확보
-    try {
-        if (impl_ && impl_->piracer_) {
-            impl_->piracer_.attr("set_throttle_percent")(0.0f);
-            impl_->piracer_.attr("set_steering_percent")(0.0f);
+    // 모터를 완전히 중지시켜 안전 확보 (비동기 출력이면 작업 스레드의 실제 출력 결과로 판단)
+    if (actuator_) {
+        if (actuator_->stop()) {
             std::cout << "[INFO] 종료 전 모터 정지 명령 전송\n";
+        } else {
+            std::cerr << "[ERROR] 종료 시 모터 정지 실패\n";
         }
-    } catch (const std::exception& e) {
-        std::cerr << "[ERROR] 종료 시 모터 정지 실패: " << e.what() << "\n";
     }
 
+    actuator_.reset();           // 비동기 출력 스레드는 stop() 에서 이미 종료됨 (GIL 을 놓은 상태여야 함)
+    impl_->gil_release_.reset(); // GIL 재획득 후 파이썬 객체 정리
     delete impl_;               // Impl 메모리 해제
     py::finalize_interpreter(); // Python 인터프리터 종료
 }
@@ -84,140 +153,172 @@ Controller::~Controller() {
 void Controller::startGamepadThread() {
     gamepad_running_ = true;
     gamepad_thread_ = std::thread([this]() {
-        while (gamepad_running_) {
+        applyThreadProfile("gamepad");
+        PeriodJitter jitter; // 입력 읽기 주기 측정
+        GamepadState pad;
+        if (evdev_gamepad_) {
+            // evdev: poll 로 입력 보고가 올 때까지 블로킹 (GIL 사용 없음)
+            while (gamepad_running_) {
+                if (evdev_gamepad_->waitReport(pad)) {
+                    jitter.tick();
+                    applyGamepad(pad);
+                    continue;
+                }
+                if (!gamepad_running_) break;
+                // 장치 분리: 수동 조작 값을 중립으로 두고 다시 연결될 때까지 재시도 (stop() 이면 종료)
+                manual_throttle_ = 0.0f;
+                manual_steering_ = 0.0f;
+                std::cerr << "[WARN] 게임패드 입력 끊김 (" << evdev_gamepad_->device() << ") -> 수동 스로틀 0, 재연결 대기\n";
+                if (!evdev_gamepad_->reconnect()) break;
+                std::cout << "[INFO] 게임패드 재연결: " << evdev_gamepad_->device() << "\n";
+            }
+        }
+        while (!evdev_gamepad_ && gamepad_running_) {
+            jitter.tick();
             try {
                 // Python GIL 획득하여 안전하게 호출
                 py::gil_scoped_acquire gil;
 
                 // gamepad.read_data()를 통해 입력 데이터 가져오기
                 auto data = impl_->gamepad_.attr("read_data")();
-
-                // A 버튼 누르면 수동 모드, B 버튼 누르면 자동 모드 전환
-                if (py::bool_(data.attr("button_a"))) manual_mode_ = true;
-                if (py::bool_(data.attr("button_b"))) manual_mode_ = false;
-
-                if (last_manual_mode_ != manual_mode_) {
-                    std::cout << "[INFO] 모드 전환 감지됨: "
-                    << (manual_mode_ ? "수동 모드로 전환" : "자동 모드로 전환\n") << std::endl;
-                    last_manual_mode_ = manual_mode_;
-
-                    //수동 모드로 전환될 때 상태 초기화
-                    if (manual_mode_) {
-                        drive_state_ = DriveState::DRIVE;
-                        crosswalk_flag = false;
-                        crosswalk_ignore_stopline = false;
-                        ROI_REMOVE_LEFT = false;
-                        WHITE_LINE_DRIVE = true;
-                        std::cout << "[INFO] 수동 모드 진입 -> 내부 상태 초기화 완료\n";
-                    }
-                }
-
-                // 우측 스틱 Y축 -> throttle, 좌측 스틱 X축 -> steering
-                manual_throttle_ = data.attr("analog_stick_right").attr("y").cast<float>() * 0.5f;
-                manual_steering_ = data.attr("analog_stick_left").attr("x").cast<float>();
+                pad.button_a = py::bool_(data.attr("button_a"));
+                pad.button_b = py::bool_(data.attr("button_b"));
+                pad.left_x = data.attr("analog_stick_left").attr("x").cast<float>();
+                pad.left_y = data.attr("analog_stick_left").attr("y").cast<float>();
+                pad.right_x = data.attr("analog_stick_right").attr("x").cast<float>();
+                pad.right_y = data.attr("analog_stick_right").attr("y").cast<float>();
             }
             catch (const std::exception& e) {
                 std::cerr << "[WARN] Gamepad read failed: " << e.what() << "\n";
                 std::this_thread::sleep_for(std::chrono::milliseconds(50)); // 짧게 대기 후 재시도
+                continue;
             }
+            applyGamepad(pad);
         }
+        jitter.report("gamepad");
     });
 }
 
-// update: 메인 루프에서 호출되어 주행 제어 로직 수행
-// stop_line: 정지선 감지 여부
-// crosswalk: 횡단보도 감지 여부
-// start_line: 출발선 감지 여부
-// cross_offset: 차선 중심 대비 오프셋
-// yellow_pixel_count: 노란색 차선 픽셀 수
-void Controller::update(bool stop_line, bool crosswalk, bool start_line, int cross_offset, int yellow_pixel_count) {
-    py::gil_scoped_acquire acquire; // Python 호출 전 GIL 획득
+// applyGamepad: 게임패드 입력 한 번을 수동 모드/수동 조작 값에 반영 (게임패드 스레드)
+void Controller::applyGamepad(const GamepadState& pad) {
+    // A 버튼 누르면 수동 모드, B 버튼 누르면 자동 모드 전환
+    if (pad.button_a) manual_mode_ = true;
+    if (pad.button_b) manual_mode_ = false;
+
+    if (last_manual_mode_ != manual_mode_) {
+        std::cout << "[INFO] 모드 전환 감지됨: "
+        << (manual_mode_ ? "수동 모드로 전환" : "자동 모드로 전환\n") << std::endl;
+        last_manual_mode_ = manual_mode_;
+
+        //수동 모드로 전환될 때 상태 초기화 (제어 스레드의 다음 update() 에서 수행)
+        if (manual_mode_) reset_requested_ = true;
+    }
+
+    // 우측 스틱 Y축 -> throttle, 좌측 스틱 X축 -> steering
+    manual_throttle_ = pad.right_y * 0.5f;
+    manual_steering_ = pad.left_x;
+}
+
+// update: 제어 스레드에서 호출되어 주행 제어 로직 수행
+// snapshot: ResultJoiner 가 프레임 ID 로 맞춘 차선/객체 검출 결과
+void Controller::update(const PerceptionSnapshot& snapshot) {
+    const bool stop_line = snapshot.object.stop_line;        // 정지선 감지 여부
+    const bool crosswalk = snapshot.object.crosswalk;        // 횡단보도 감지 여부
+    const bool start_line = snapshot.object.start_line;      // 출발선 감지 여부
+    const int yellow_pixel_count = snapshot.lane.yellow_pixel_count; // 노란색 차선 픽셀 수
+    const Config& cfg = config();
+
+    // 게임패드 스레드가 요청한 상태 초기화 (주행 상태는 제어 스레드에서만 변경)
+    if (reset_requested_.exchange(false)) {
+        drive_state_ = DriveState::DRIVE;
+        crosswalk_flag_ = false;
+        crosswalk_ignore_stopline_ = false;
+        roi_remove_left_ = false;
+        white_line_drive_ = true;
+        std::cout << "[INFO] 수동 모드 진입 -> 내부 상태 초기화 완료\n";
+    }
 
     // std::cout << "[제어 출력] 모드: " << (manual_mode_ ? "수동" : "자동") << " | 상태: ";
 
-    try {
-        if (manual_mode_) {
-            // 수동 모드: 조이스틱 입력값 그대로 적용
-            throttle_ = manual_throttle_ - 0.2f; 
-            steering_ = manual_steering_- 0.35f;
-        } else {
-            // 자동 모드: 상태 머신 기반 제어
-            if (drive_state_ == DriveState::DRIVE && !crosswalk_flag) {
-                // 일반 주행 중
-                if (crosswalk) {
-                    // 횡단보도 감지 시 대기 상태로 전환
-                    crosswalk_flag = true;
-                    drive_state_ = DriveState::WAIT_AFTER_CROSSWALK;
-                    wait_start_time_ = steady_clock::now();
-                    std::cout << "[INFO] 횡단보도 감지됨 → 대기 시작\n";
-                }
+    if (manual_mode_) {
+        // 수동 모드: 조이스틱 입력값 그대로 적용
+        throttle_ = manual_throttle_ - 0.2f; 
+        steering_ = manual_steering_- 0.35f;
+        steering_law_.reset();
+    } else {
+        // 자동 모드: 상태 머신 기반 제어
+        if (drive_state_ == DriveState::DRIVE && !crosswalk_flag_) {
+            // 일반 주행 중
+            if (crosswalk) {
+                // 횡단보도 감지 시 대기 상태로 전환
+                crosswalk_flag_ = true;
+                drive_state_ = DriveState::WAIT_AFTER_CROSSWALK;
+                wait_start_time_ = steady_clock::now();
+                std::cout << "[INFO] 횡단보도 감지됨 → 대기 시작\n";
             }
-            else if (drive_state_ == DriveState::DRIVE && crosswalk_flag) {
-                // 횡단보도 이후 주행 재개 및 정지선 처리
-                if (crosswalk_ignore_stopline) {
-                    // 무시 기간 이후 정지선 감지 재활성화
-                    auto since_resume = duration_cast<seconds>(steady_clock::now() - crosswalk_resume_time).count();
-                    if (since_resume > 2) {
-                        crosswalk_ignore_stopline = false;
-                        std::cout << "[INFO] 정지선 감지 다시 활성화됨\n";
-                    }
-                } else if (start_line) {
-                    // 출발선 감지 시 정지 상태로 전환
-                    drive_state_ = DriveState::STOP_AT_START_LINE;
-                    std::cout << "[INFO] 출발선 감지 → 정지\n";
-                } else if (stop_line) {
-                    // 정지선 감지 시 노란 차선 주행 전환
-                    drive_state_ = DriveState::YELLOW_LINE_DRIVE;
-                    std::cout << "[INFO] 정지선 감지됨 → 노란 차선 주행으로 전환\n";
+        }
+        else if (drive_state_ == DriveState::DRIVE && crosswalk_flag_) {
+            // 횡단보도 이후 주행 재개 및 정지선 처리
+            if (crosswalk_ignore_stopline_) {
+                // 무시 기간 이후 정지선 감지 재활성화
+                auto since_resume = duration_cast<seconds>(steady_clock::now() - crosswalk_resume_time_).count();
+                if (since_resume > 2) {
+                    crosswalk_ignore_stopline_ = false;
+                    std::cout << "[INFO] 정지선 감지 다시 활성화됨\n";
                 }
+            } else if (start_line) {
+                // 출발선 감지 시 정지 상태로 전환
+                drive_state_ = DriveState::STOP_AT_START_LINE;
+                std::cout << "[INFO] 출발선 감지 → 정지\n";
+            } else if (stop_line) {
+                // 정지선 감지 시 노란 차선 주행 전환
+                drive_state_ = DriveState::YELLOW_LINE_DRIVE;
+                std::cout << "[INFO] 정지선 감지됨 → 노란 차선 주행으로 전환\n";
             }
-            else if (drive_state_ == DriveState::WAIT_AFTER_CROSSWALK) {
-                // 대기 후 지정 시간 경과 시 주행 재개
-                auto elapsed = duration_cast<seconds>(steady_clock::now() - wait_start_time_).count();
-                if (elapsed >= WAIT_SECONDS) {
-                    crosswalk_ignore_stopline = true;  // 정지선 무시 시작
-                    crosswalk_resume_time = steady_clock::now();
-                    drive_state_ = DriveState::DRIVE;
-                    std::cout << "[INFO] 횡단보도 정지 후 주행 재개\n";
-                }
+        }
+        else if (drive_state_ == DriveState::WAIT_AFTER_CROSSWALK) {
+            // 대기 후 지정 시간 경과 시 주행 재개
+            auto elapsed = duration_cast<seconds>(steady_clock::now() - wait_start_time_).count();
+            if (elapsed >= cfg.WAIT_SECONDS) {
+                crosswalk_ignore_stopline_ = true;  // 정지선 무시 시작
+                crosswalk_resume_time_ = steady_clock::now();
+                drive_state_ = DriveState::DRIVE;
+                std::cout << "[INFO] 횡단보도 정지 후 주행 재개\n";
             }
-            else if (drive_state_ == DriveState::STOP_AT_START_LINE) {
-                // 정지 상태: throttle_ = 0 로 설정됨
+        }
+        else if (drive_state_ == DriveState::STOP_AT_START_LINE) {
+            // 정지 상태: throttle_ = 0 로 설정됨
+        }
+        else if (drive_state_ == DriveState::YELLOW_LINE_DRIVE) {
+            // 노란 차선 주행 상태: 좌측 ROI 제거, 흰색 주행 비활성화
+            roi_remove_left_ = true;
+            white_line_drive_ = false;
+            // 노란 픽셀 감소 시 일반 주행으로 복귀
+            if (stop_line) {
+                use_steering_offset_2_ = true;
             }
-            else if (drive_state_ == DriveState::YELLOW_LINE_DRIVE) {
-                // 노란 차선 주행 상태: 좌측 ROI 제거, 흰색 주행 비활성화
-                ROI_REMOVE_LEFT = true;
-                WHITE_LINE_DRIVE = false;
-                // 노란 픽셀 감소 시 일반 주행으로 복귀
-                if (stop_line) {
-                    STEERING_OFFSET = STEERING_OFFSET_2;
-                }
 
-                if (yellow_pixel_count < YELLOW_PIXEL_THRESHOLD) {
-                    drive_state_ = DriveState::DRIVE;
-                    ROI_REMOVE_LEFT = false;
-                    WHITE_LINE_DRIVE = true;
-                    std::cout << "[INFO] 노란 차선 사라짐 → 일반 흰색 차선 주행으로 전환\n";
-                }
+            if (yellow_pixel_count < cfg.YELLOW_PIXEL_THRESHOLD) {
+                drive_state_ = DriveState::DRIVE;
+                roi_remove_left_ = false;
+                white_line_drive_ = true;
+                std::cout << "[INFO] 노란 차선 사라짐 → 일반 흰색 차선 주행으로 전환\n";
             }
+        }
 
-            // 스로틀 설정: 정지 상태면 0, 아니면 함수 호출
-            if (drive_state_ == DriveState::STOP_AT_START_LINE ||
-                drive_state_ == DriveState::WAIT_AFTER_CROSSWALK) {
-                throttle_ = 0.0f;
-            } else {
-                throttle_ = computeThrottle(cross_offset);
-            }
-            // 스티어링 설정: 차선 오프셋 기반 계산
-            steering_ = computeSteering(cross_offset);
+        // 스로틀 설정: 정지 상태면 0, 아니면 함수 호출
+        if (drive_state_ == DriveState::STOP_AT_START_LINE ||
+            drive_state_ == DriveState::WAIT_AFTER_CROSSWALK) {
+            throttle_ = 0.0f;
+            steering_law_.reset(); // 정지 중에는 적분 누적 안 함
+        } else {
+            throttle_ = computeThrottle(snapshot.lane);
         }
-        // PiRacerPro Python 객체에 제어 명령 전송
-        impl_->piracer_.attr("set_steering_percent")(steering_);
-        impl_->piracer_.attr("set_throttle_percent")(throttle_);
-    }
-    catch (const std::exception& e) {
-        std::cerr << "[ERROR] Python 제어 실패: " << e.what() << "\n";
+        // 스티어링 설정: 차선 오프셋/기울기 기반 계산 (프레임 시각으로 지연 보상)
+        steering_ = computeSteering(snapshot.lane);
     }
+    // 조향/스로틀을 한 번에 출력 (백엔드는 ACTUATOR_BACKEND)
+    if (actuator_) actuator_->set(steering_, throttle_);
     // 현재 상태 로그 출력
     // switch (drive_state_) {
     //     case DriveState::DRIVE:                  std::cout << "주행"; break;
@@ -225,17 +326,57 @@ void Controller::update(bool stop_line, bool crosswalk, bool start_line, int cro
     //     case DriveState::STOP_AT_START_LINE:     std::cout << "출발선 정지"; break;
     //     default:                                 break;
     // }
-    // std::cout << " | cross_offset: " << cross_offset
+    // std::cout << " | cross_offset: " << snapshot.lane.offset
     //           << " | steering: " << steering_
     //           << " | throttle: " << throttle_ << "\n";
 }
 
-// computeSteering: 오프셋 기반 조향 계산 (비례 제어 + 범위 제한)
-float Controller::computeSteering(int offset) const {
-    return std::clamp(STEERING_OFFSET + STEERING_KP * offset, -0.7f, 0.7f);
+// detectorSchedule: update() 의 상태 머신이 현재 상태에서 참조하는 검출 결과만 관심 대상으로 표시
+// - DRIVE (횡단보도 전)        : 횡단보도
+// - DRIVE (횡단보도 후)        : 정지선 무시 기간이면 없음, 아니면 출발선 + 정지선
+// - YELLOW_LINE_DRIVE         : 정지선 (조향 보정)
+// - WAIT / STOP_AT_START_LINE : 없음
+// 관심 없는 검출기는 DETECTOR_IDLE_DECIMATION 간격으로만 실행 (0: 건너뜀), 차선은 항상 매 프레임
+DetectorSchedule Controller::detectorSchedule() const {
+    const Config& cfg = config();
+    DetectorSchedule schedule;
+    schedule.roi_remove_left = roi_remove_left_;
+    schedule.white_line_drive = white_line_drive_;
+    if (!cfg.ADAPTIVE_DETECTORS) return schedule;
+
+    bool stop = false, cross = false, start = false;
+    switch (drive_state_) {
+        case DriveState::DRIVE:
+            if (!crosswalk_flag_) {
+                cross = true;
+            } else if (!crosswalk_ignore_stopline_) {
+                start = true;
+                stop = true;
+            }
+            break;
+        case DriveState::YELLOW_LINE_DRIVE:
+            stop = true;
+            break;
+        case DriveState::WAIT_AFTER_CROSSWALK:
+        case DriveState::STOP_AT_START_LINE:
+            break;
+    }
+    const uint8_t idle = static_cast<uint8_t>(std::clamp(cfg.DETECTOR_IDLE_DECIMATION, 0, 255));
+    schedule.stop_line = stop ? 1 : idle;
+    schedule.crosswalk = cross ? 1 : idle;
+    schedule.start_line = start ? 1 : idle;
+    return schedule;
+}
+
+// computeSteering: 차선 결과 기반 조향 계산 (PID + 피드포워드 + 범위 제한, SteeringController)
+// 정지선 이후 노란 차선 구간부터는 STEERING_OFFSET_2 를 중립값으로 사용
+float Controller::computeSteering(const LaneResult& lane) {
+    const Config& cfg = config();
+    const float trim = use_steering_offset_2_ ? cfg.STEERING_OFFSET_2 : cfg.STEERING_OFFSET;
+    return steering_law_.steering(lane, monotonicNs(), trim);
 }
 
-// computeThrottle: 현재 고정 스로틀 반환 (추후 속도 제어 로직 보완 가능)
-float Controller::computeThrottle(int /*offset*/) const {
-    return BASE_THROTTLE;
+// computeThrottle: 곡률 기반 스로틀 (THROTTLE_SCHEDULING 이 false 면 BASE_THROTTLE 고정)
+float Controller::computeThrottle(const LaneResult& lane) const {
+    return steering_law_.throttle(lane);
 }
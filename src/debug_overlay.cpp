@@ -0,0 +1,66 @@
+#include "debug_overlay.hpp"
+#include <cstdio>
+
+namespace {
+constexpr size_t RESERVED_COMMANDS = 256; // 한 프레임 최대 명령 수 예상치 (넘으면 한 번만 늘어남)
+}
+
+DebugOverlay::DebugOverlay() {
+    commands_.reserve(RESERVED_COMMANDS);
+}
+
+void DebugOverlay::reset(const cv::Mat& background) {
+    background_ = background;
+    commands_.clear();
+}
+
+void DebugOverlay::circle(cv::Point center, int radius, const cv::Scalar& color, int thickness) {
+    commands_.push_back({Type::CIRCLE, center, cv::Rect(), radius, 0.0, color, thickness, nullptr, 0.0f});
+}
+
+void DebugOverlay::rectangle(const cv::Rect& rect, const cv::Scalar& color, int thickness) {
+    commands_.push_back({Type::RECTANGLE, cv::Point(), rect, 0, 0.0, color, thickness, nullptr, 0.0f});
+}
+
+void DebugOverlay::text(const char* label, cv::Point org, double scale, const cv::Scalar& color, int thickness) {
+    commands_.push_back({Type::TEXT, org, cv::Rect(), 0, scale, color, thickness, label, 0.0f});
+}
+
+void DebugOverlay::text(const char* label, float value, cv::Point org, double scale, const cv::Scalar& color, int thickness) {
+    commands_.push_back({Type::TEXT_VALUE, org, cv::Rect(), 0, scale, color, thickness, label, value});
+}
+
+void DebugOverlay::append(const DebugOverlay& other) {
+    commands_.insert(commands_.end(), other.commands_.begin(), other.commands_.end());
+}
+
+void DebugOverlay::render(cv::Mat& out) const {
+    if (background_.empty()) {
+        out.release();
+        return;
+    }
+    if (background_.channels() == 1) {
+        cv::cvtColor(background_, out, cv::COLOR_GRAY2BGR);
+    } else {
+        background_.copyTo(out);
+    }
+
+    char buffer[64];
+    for (const Command& cmd : commands_) {
+        switch (cmd.type) {
+        case Type::CIRCLE:
+            cv::circle(out, cmd.point, cmd.radius, cmd.color, cmd.thickness);
+            break;
+        case Type::RECTANGLE:
+            cv::rectangle(out, cmd.rect, cmd.color, cmd.thickness);
+            break;
+        case Type::TEXT:
+            cv::putText(out, cmd.label, cmd.point, cv::FONT_HERSHEY_SIMPLEX, cmd.scale, cmd.color, cmd.thickness);
+            break;
+        case Type::TEXT_VALUE:
+            std::snprintf(buffer, sizeof(buffer), "%s%f", cmd.label, cmd.value);
+            cv::putText(out, buffer, cmd.point, cv::FONT_HERSHEY_SIMPLEX, cmd.scale, cmd.color, cmd.thickness);
+            break;
+        }
+    }
+}
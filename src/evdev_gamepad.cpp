@@ -0,0 +1,181 @@
+#include "evdev_gamepad.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <linux/input.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+// EVIOCGBIT 비트 배열에서 code 비트 확인
+bool testBit(const uint8_t* bits, int code) {
+    return (bits[code / 8] >> (code % 8)) & 1;
+}
+}
+
+EvdevGamepad::EvdevGamepad(const std::string& device)
+    : requested_(device), device_(device), pending_(new input_event[PENDING_EVENTS]) {}
+
+EvdevGamepad::~EvdevGamepad() {
+    closeDevice();
+    if (wake_fd_ >= 0) ::close(wake_fd_);
+}
+
+void EvdevGamepad::closeDevice() {
+    if (fd_ >= 0) ::close(fd_);
+    if (fifo_keepalive_fd_ >= 0) ::close(fifo_keepalive_fd_);
+    fd_ = -1;
+    fifo_keepalive_fd_ = -1;
+    pending_count_ = pending_next_ = 0;  // 분리된 장치에서 읽다 남은 이벤트는 버림
+}
+
+std::string EvdevGamepad::findDevice() {
+    for (int i = 0; i < 32; ++i) {
+        const std::string path = "/dev/input/event" + std::to_string(i);
+        int fd = ::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) continue;
+        uint8_t keys[KEY_MAX / 8 + 1] = {};
+        uint8_t abs[ABS_MAX / 8 + 1] = {};
+        const bool gamepad = ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keys)), keys) >= 0 &&
+                             ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(abs)), abs) >= 0 &&
+                             testBit(keys, BTN_A) && testBit(abs, ABS_RZ);
+        ::close(fd);
+        if (gamepad) return path;
+    }
+    return "";
+}
+
+bool EvdevGamepad::open() {
+    if (wake_fd_ < 0) {
+        wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (wake_fd_ < 0) {
+            std::cerr << "[ERROR] eventfd 생성 실패: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+    }
+    if (!openDevice(true)) return false;
+    std::cout << "[INFO] evdev 게임패드 열기 성공: " << device_ << std::endl;
+    return true;
+}
+
+bool EvdevGamepad::openDevice(bool verbose) {
+    closeDevice();
+    device_ = requested_;
+    if (device_ == "auto") {
+        device_ = findDevice();
+        if (device_.empty()) {
+            if (verbose) std::cerr << "[WARN] 게임패드 event 장치를 찾지 못함" << std::endl;
+            return false;
+        }
+    }
+    // FIFO 는 쓰는 쪽이 열릴 때까지 블로킹하지 않도록 O_NONBLOCK 으로 염
+    fd_ = ::open(device_.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd_ < 0) {
+        if (verbose) {
+            std::cerr << "[ERROR] 게임패드 장치 열기 실패: " << device_ << " (" << std::strerror(errno) << ")" << std::endl;
+        }
+        return false;
+    }
+    // 가짜 장치(FIFO): 쓰기 끝을 직접 하나 열어 두어 입력 프로그램이 닫혀도 EOF 로 끝나지 않게 함
+    struct stat st{};
+    if (fstat(fd_, &st) == 0 && S_ISFIFO(st.st_mode)) {
+        fifo_keepalive_fd_ = ::open(device_.c_str(), O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    }
+    x_ = y_ = z_ = rz_ = AxisRange();
+    readAxisRange(ABS_X, x_);
+    readAxisRange(ABS_Y, y_);
+    readAxisRange(ABS_Z, z_);
+    readAxisRange(ABS_RZ, rz_);
+    return true;
+}
+
+bool EvdevGamepad::reconnect() {
+    if (wake_fd_ < 0) return false;
+    closeDevice();
+    int delay_ms = RECONNECT_MIN_MS;
+    while (true) {
+        // 대기 중에도 stop() 으로 바로 깨어남
+        pollfd wake = {wake_fd_, POLLIN, 0};
+        const int ready = poll(&wake, 1, delay_ms);
+        if (ready < 0 && errno != EINTR) return false;
+        if (ready > 0) return false;
+
+        if (openDevice(false)) {
+            state_ = GamepadState();  // 분리 전에 눌려 있던 버튼/스틱 값은 버림
+            return true;
+        }
+        delay_ms = std::min(delay_ms * 2, RECONNECT_MAX_MS);
+    }
+}
+
+void EvdevGamepad::readAxisRange(int code, AxisRange& range) {
+    input_absinfo info{};
+    if (ioctl(fd_, EVIOCGABS(code), &info) == 0 && info.maximum > info.minimum) {
+        range.min = info.minimum;
+        range.max = info.maximum;
+    }
+}
+
+float EvdevGamepad::normalize(int value, const AxisRange& range) {
+    const float center = 0.5f * (range.min + range.max);
+    const float half = 0.5f * (range.max - range.min);
+    return std::clamp((value - center) / half, -1.0f, 1.0f);
+}
+
+bool EvdevGamepad::waitReport(GamepadState& state) {
+    while (true) {
+        // 직전 read() 에서 남은 이벤트부터 SYN_REPORT 단위로 반영 (보고 여러 개가 한 번에 읽혀도 하나씩 돌려줌)
+        while (pending_next_ < pending_count_) {
+            const input_event& ev = pending_[pending_next_++];
+            if (ev.type == EV_KEY) {
+                if (ev.code == BTN_A) state_.button_a = ev.value != 0;
+                if (ev.code == BTN_B) state_.button_b = ev.value != 0;
+            } else if (ev.type == EV_ABS) {
+                // y 축은 아래가 양수라 piracer 와 같게 부호 반전
+                if (ev.code == ABS_X) state_.left_x = normalize(ev.value, x_);
+                if (ev.code == ABS_Y) state_.left_y = -normalize(ev.value, y_);
+                if (ev.code == ABS_Z) state_.right_x = normalize(ev.value, z_);
+                if (ev.code == ABS_RZ) state_.right_y = -normalize(ev.value, rz_);
+            } else if (ev.type == EV_SYN && ev.code == SYN_REPORT) {
+                state = state_;
+                return true;
+            }
+        }
+        if (fd_ < 0) return false;
+
+        pollfd fds[2] = {{fd_, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (fds[1].revents) return false;
+
+        const ssize_t n = ::read(fd_, pending_.get(), PENDING_EVENTS * sizeof(input_event));
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EINTR) continue;
+            // 장치 분리는 ENODEV
+            std::cerr << "[WARN] 게임패드 읽기 실패: " << std::strerror(errno) << std::endl;
+            closeDevice();
+            return false;
+        }
+        if (n == 0) {  // 쓰는 쪽이 모두 닫힘
+            closeDevice();
+            return false;
+        }
+        pending_count_ = static_cast<size_t>(n) / sizeof(input_event);
+        pending_next_ = 0;
+    }
+}
+
+void EvdevGamepad::stop() {
+    if (wake_fd_ < 0) return;
+    const uint64_t one = 1;
+    ssize_t written = ::write(wake_fd_, &one, sizeof(one));
+    (void)written;
+}
@@ -0,0 +1,133 @@
+#include "file_capture.hpp"
+#include "latency_stats.hpp"
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+namespace {
+constexpr int POLL_TIMEOUT_MS = 1000;  // 버퍼 반환 대기 최대 시간 (V4L2 백엔드와 같음)
+constexpr int HELD_WAIT_MIN_US = 500;  // 버퍼 반환 대기 첫 간격
+constexpr int HELD_WAIT_MAX_US = 8000; // 버퍼 반환 대기 최대 간격
+constexpr int64_t HELD_WARN_INTERVAL_NS = 1000000000LL; // 버퍼 부족 경고 최소 간격
+}
+
+FileCapture::FileCapture(const std::string& path, int width, int height, uint32_t fourcc, int buffer_count, int fps)
+    : path_(path), width_(width), height_(height), fourcc_(fourcc), buffer_count_(buffer_count),
+      period_(std::chrono::nanoseconds(1000000000LL / std::max(fps, 1))) {}
+
+bool FileCapture::open() {
+    const int bpp = bytesPerPixel(fourcc_);
+    if (bpp == 0) {
+        std::cerr << "[ERROR] 지원하지 않는 픽셀 형식: " << fourccToString(fourcc_) << std::endl;
+        return false;
+    }
+
+    file_.open(path_, std::ios::binary);
+    if (!file_.is_open()) {
+        std::cerr << "[ERROR] 가짜 카메라 파일 열기 실패: " << path_ << std::endl;
+        return false;
+    }
+    file_.seekg(0, std::ios::end);
+    frame_bytes_ = static_cast<size_t>(width_) * height_ * bpp;
+    frame_count_ = static_cast<long>(static_cast<size_t>(file_.tellg()) / frame_bytes_);
+    if (frame_count_ == 0) {
+        std::cerr << "[ERROR] 가짜 카메라 파일에 완전한 프레임이 없습니다: " << path_ << std::endl;
+        return false;
+    }
+
+    const int type = (bpp == 3) ? CV_8UC3 : (bpp == 2) ? CV_8UC2 : CV_8UC1;
+    buffers_.resize(std::max(buffer_count_, 2));
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        buffers_[i].image.create(height_, width_, type);
+        buffers_[i].token = std::make_shared<int>(static_cast<int>(i));
+    }
+    start_ = std::chrono::steady_clock::now();
+    next_sequence_ = 0;
+
+    std::cout << "[INFO] 가짜 카메라 시작: " << path_ << " " << width_ << "x" << height_
+              << " " << fourccToString(fourcc_) << ", " << frame_count_ << "프레임 반복" << std::endl;
+    return true;
+}
+
+bool FileCapture::readFrame(cv::Mat& dst) {
+    for (int y = 0; y < dst.rows; ++y) {
+        file_.read(reinterpret_cast<char*>(dst.ptr(y)), static_cast<std::streamsize>(dst.cols * dst.elemSize()));
+    }
+    if (!file_) {
+        file_.clear();
+        return false;
+    }
+    return true;
+}
+
+// 하류에서 모두 놓은 버퍼 선택 (실제 장치의 QBUF 대기열에 해당)
+FileCapture::Buffer* FileCapture::findReleasedBuffer() {
+    for (Buffer& b : buffers_) {
+        if (b.token.use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return &b;
+        }
+    }
+    return nullptr;
+}
+
+// 모든 버퍼를 하류가 들고 있으면 반환될 때까지 간격을 늘려 가며 대기 (최대 POLL_TIMEOUT_MS)
+FileCapture::Buffer* FileCapture::waitForReleasedBuffer() {
+    const int64_t start_ns = monotonicNs();
+    int delay_us = HELD_WAIT_MIN_US;
+    while (true) {
+        if (Buffer* b = findReleasedBuffer()) return b;
+        if (monotonicNs() - start_ns >= static_cast<int64_t>(POLL_TIMEOUT_MS) * 1000000LL) return nullptr;
+        std::this_thread::sleep_for(std::chrono::microseconds(delay_us));
+        delay_us = std::min(delay_us * 2, HELD_WAIT_MAX_US);
+    }
+}
+
+bool FileCapture::read(CapturedFrame& out) {
+    out.hold.reset();
+    out.image.release();
+    if (!file_.is_open()) return false;
+
+    // 다음 프레임이 아직 "도착"하지 않았으면 도착 시각까지 대기
+    auto now = std::chrono::steady_clock::now();
+    long arrived = static_cast<long>((now - start_) / period_);
+    if (arrived < static_cast<long>(next_sequence_)) {
+        std::this_thread::sleep_until(start_ + period_ * next_sequence_);
+        arrived = next_sequence_;
+    }
+
+    Buffer* free_buffer = findReleasedBuffer();
+    if (!free_buffer) {
+        // 하류가 버퍼를 놓을 때까지 대기 (바로 false 를 돌려주면 카메라 루프가 쉬지 않고 재시도함)
+        ++held_waits_;
+        const int64_t now_ns = monotonicNs();
+        if (now_ns - last_held_warn_ns_ >= HELD_WARN_INTERVAL_NS) {
+            std::cerr << "[WARN] 모든 가짜 카메라 버퍼가 사용 중, 반환 대기 " << held_waits_
+                      << "회 (CAMERA_BUFFER_COUNT 를 늘리세요)" << std::endl;
+            last_held_warn_ns_ = now_ns;
+            held_waits_ = 0;
+        }
+        free_buffer = waitForReleasedBuffer();
+        if (!free_buffer) return false;
+        // 기다리는 동안 도착한 프레임이 있으면 가장 최근 것으로
+        arrived = std::max(arrived, static_cast<long>((std::chrono::steady_clock::now() - start_) / period_));
+    }
+
+    // 밀린 프레임은 건너뛰고 가장 최근에 도착한 프레임만 읽음
+    file_.seekg(static_cast<std::streamoff>((arrived % frame_count_) * frame_bytes_));
+    if (!readFrame(free_buffer->image)) {
+        std::cerr << "[WARN] 가짜 카메라 프레임 읽기 실패" << std::endl;
+        return false;
+    }
+
+    out.image = free_buffer->image;
+    out.fourcc = fourcc_;
+    out.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        (start_ + period_ * arrived).time_since_epoch()).count();
+    out.sequence = static_cast<uint32_t>(arrived);
+    out.hold = free_buffer->token;
+    next_sequence_ = static_cast<uint32_t>(arrived + 1);
+    return true;
+}
@@ -0,0 +1,117 @@
+#include "frame_channel.hpp"
+#include <iostream>
+#include <utility>
+
+FrameChannel::Ref::Ref(Ref&& other) noexcept
+    : slot_(std::exchange(other.slot_, nullptr)), id_(std::exchange(other.id_, 0)) {}
+
+FrameChannel::Ref& FrameChannel::Ref::operator=(Ref&& other) noexcept {
+    if (this != &other) {
+        reset();
+        slot_ = std::exchange(other.slot_, nullptr);
+        id_ = std::exchange(other.id_, 0);
+    }
+    return *this;
+}
+
+void FrameChannel::Ref::reset() {
+    if (slot_) slot_->refs.fetch_sub(1, std::memory_order_release);
+    slot_ = nullptr;
+    id_ = 0;
+}
+
+FrameChannel::FrameChannel(int slot_count)
+    : slots_(new Slot[slot_count]), slot_count_(slot_count) {
+    if (slot_count < 3 || slot_count > static_cast<int>(SLOT_MASK)) {
+        std::cerr << "[ERROR] FrameChannel 슬롯 수가 범위를 벗어났습니다: " << slot_count << std::endl;
+    }
+    for (int i = 0; i < slot_count_; ++i) slots_[i].frame.allocate();
+}
+
+PreprocessedFrame* FrameChannel::beginWrite() {
+    const int latest_slot = static_cast<int>(latest_.load(std::memory_order_relaxed) & SLOT_MASK);
+    const bool has_latest = latest_.load(std::memory_order_relaxed) != 0;
+    int found = -1;
+    for (int n = 0; n < slot_count_; ++n) {
+        int i = (next_slot_ + n) % slot_count_;
+        if (has_latest && i == latest_slot) continue; // 최신 프레임은 그대로 둠
+        uint32_t expected = 0;
+        if (!slots_[i].refs.compare_exchange_strong(expected, WRITER, std::memory_order_acquire,
+                                                    std::memory_order_relaxed)) {
+            continue; // 소비자가 읽는 중
+        }
+        if (found < 0) {
+            found = i;
+        } else {
+            // 쉬는 슬롯이 잡고 있는 카메라 버퍼는 바로 드라이버에 돌려줌
+            slots_[i].frame.releaseCapture();
+            slots_[i].refs.fetch_sub(WRITER, std::memory_order_release);
+        }
+    }
+    if (found < 0) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    writing_ = found;
+    next_slot_ = (found + 1) % slot_count_;
+    return &slots_[found].frame;
+}
+
+uint64_t FrameChannel::publish() {
+    if (writing_ < 0) return 0;
+    Slot& slot = slots_[writing_];
+    const uint64_t id = next_id_++;
+    slot.id.store(id, std::memory_order_relaxed);
+    slot.refs.fetch_sub(WRITER, std::memory_order_release);
+    latest_.store((id << SLOT_BITS) | static_cast<uint64_t>(writing_), std::memory_order_seq_cst);
+    writing_ = -1;
+
+    // 잠든 소비자가 있을 때만 깨움
+    if (waiters_.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        wait_cv_.notify_all();
+    }
+    return id;
+}
+
+bool FrameChannel::latest(Ref& ref) {
+    ref.reset();
+    while (true) {
+        const uint64_t packed = latest_.load(std::memory_order_acquire);
+        if (packed == 0) return false;
+        Slot& slot = slots_[packed & SLOT_MASK];
+        const uint64_t id = packed >> SLOT_BITS;
+        // 참조를 먼저 올린 뒤 슬롯이 그 사이 재사용되지 않았는지 확인
+        const uint32_t refs = slot.refs.fetch_add(1, std::memory_order_acq_rel);
+        if (!(refs & WRITER) && slot.id.load(std::memory_order_acquire) == id) {
+            ref.slot_ = &slot;
+            ref.id_ = id;
+            return true;
+        }
+        slot.refs.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+bool FrameChannel::waitNext(uint64_t last_id, Ref& ref, std::chrono::milliseconds timeout) {
+    if (published() <= last_id) {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(wait_mutex_);
+            wait_cv_.wait_for(lock, timeout, [&] {
+                return closed_.load(std::memory_order_relaxed) || published() > last_id;
+            });
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        if (published() <= last_id) {
+            ref.reset();
+            return false;
+        }
+    }
+    return latest(ref);
+}
+
+void FrameChannel::close() {
+    closed_.store(true);
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    wait_cv_.notify_all();
+}
@@ -0,0 +1,151 @@
+#include "frame_preprocessor.hpp"
+#include "constants.hpp"
+#include "config.hpp"
+#include <iostream>
+#include <algorithm>
+
+namespace {
+// rows 밖의 행을 0으로 채움
+void clearOutsideRows(cv::Mat& mat, cv::Range rows) {
+    if (rows.start > 0) mat.rowRange(0, rows.start).setTo(0);
+    if (rows.end < mat.rows) mat.rowRange(rows.end, mat.rows).setTo(0);
+}
+}
+
+void PreprocessedFrame::allocate() {
+    const cv::Size size(FRAME_WIDTH, FRAME_HEIGHT);
+    grayscale.create(size, CV_8UC1);
+    white_mask.create(size, CV_8UC1);
+    yellow_mask.create(size, CV_8UC1);
+    owned_bgr.create(size, CV_8UC3);
+}
+
+void PreprocessedFrame::releaseCapture() {
+    frame.release();
+    capture_hold.reset();
+}
+
+FramePreprocessor::FramePreprocessor() {
+    // 주행 크기 기준으로 작업 버퍼 미리 할당
+    const cv::Size size(FRAME_WIDTH, FRAME_HEIGHT);
+    hsv_.create(size, CV_8UC3);
+    for (auto& channel : hsv_channels_) channel.create(size, CV_8UC1);
+    valid_mask_.create(size, CV_8UC1);
+    scratch_mask_.create(size, CV_8UC1);
+}
+
+void FramePreprocessor::process(const cv::Mat& frame, PreprocessedFrame& out) {
+    CapturedFrame captured;
+    captured.image = frame;
+    process(captured, out);
+}
+
+void FramePreprocessor::process(const CapturedFrame& captured, PreprocessedFrame& out) {
+    const cv::Mat& frame = captured.image;
+    out.releaseCapture();
+    if (frame.empty()) {
+        std::cerr << "[FramePreprocessor] 입력 프레임이 비어있습니다." << std::endl;
+        return;
+    }
+
+    // Bayer 원본은 쿼드 단위로 바로 분류 (출력은 주행 크기)
+    int red_x = 0, red_y = 0;
+    const bool bayer = bayerRedOffset(captured.fourcc, red_x, red_y);
+
+    int height = bayer ? FRAME_HEIGHT : frame.rows;
+    int width = bayer ? FRAME_WIDTH : frame.cols;
+    if (roi_mask_.rows != height || roi_mask_.cols != width) {
+        roi_mask_ = createTrapezoidMask(height, width);
+    }
+
+    // 검출기가 읽는 행만 분류
+    cv::Range rows = (crop_rows_ == cv::Range::all()) ? cv::Range(0, height)
+        : cv::Range(std::clamp(crop_rows_.start, 0, height), std::clamp(crop_rows_.end, 0, height));
+
+    // 출력 Mat 크기가 같으면 create() 는 기존 버퍼를 그대로 사용
+    out.grayscale.create(height, width, CV_8UC1);
+    out.white_mask.create(height, width, CV_8UC1);
+    out.yellow_mask.create(height, width, CV_8UC1);
+    if (bayer) {
+        out.owned_bgr.create(height, width, CV_8UC3);
+        classifier_.classifyBayer(frame, red_x, red_y, roi_mask_, rows, out.owned_bgr,
+                                  out.grayscale, out.white_mask, out.yellow_mask);
+        clearOutsideRows(out.owned_bgr, rows);
+        out.frame = out.owned_bgr;
+    } else {
+        // 행 범위 헤더에 바로 기록 (크기가 같으므로 부모 버퍼에 씀)
+        cv::Mat gray_rows = out.grayscale.rowRange(rows);
+        cv::Mat white_rows = out.white_mask.rowRange(rows);
+        cv::Mat yellow_rows = out.yellow_mask.rowRange(rows);
+        if (COLOR_CLASSIFIER == "lut") {
+            classifier_.classify(frame.rowRange(rows), roi_mask_.rowRange(rows), gray_rows, white_rows, yellow_rows);
+        } else {
+            classifyHsv(frame.rowRange(rows), roi_mask_.rowRange(rows), gray_rows, white_rows, yellow_rows);
+        }
+        out.frame = frame;
+    }
+    clearOutsideRows(out.grayscale, rows);
+    clearOutsideRows(out.white_mask, rows);
+    clearOutsideRows(out.yellow_mask, rows);
+
+    out.roi_mask = roi_mask_;
+    out.classified_rows = rows;
+    out.capture_ns = captured.timestamp_ns;
+    out.sequence = captured.sequence;
+    // Bayer 경로는 원본을 더 참조하지 않으므로 드라이버 버퍼를 바로 돌려줌
+    out.capture_hold = bayer ? nullptr : captured.hold;
+}
+
+void FramePreprocessor::setCropRows(cv::Range rows) {
+    crop_rows_ = rows;
+}
+
+void FramePreprocessor::classifyHsv(const cv::Mat& frame, const cv::Mat& roi_mask, cv::Mat& grayscale, cv::Mat& white_mask, cv::Mat& yellow_mask) {
+    cv::cvtColor(frame, hsv_, cv::COLOR_BGR2HSV);
+    cv::split(hsv_, hsv_channels_);
+    const cv::Mat& h = hsv_channels_[0];
+    const cv::Mat& s = hsv_channels_[1];
+    const cv::Mat& v = hsv_channels_[2];
+
+    // 유효 마스크
+    const Config& cfg = config();
+    cv::compare(v, cv::Scalar(cfg.VALID_V_MIN), valid_mask_, cv::CMP_GE);
+    cv::bitwise_and(valid_mask_, roi_mask, valid_mask_);
+
+    // 흰색: s < WHITE_S_MAX && v >= WHITE_V_MIN
+    cv::compare(s, cv::Scalar(cfg.WHITE_S_MAX), scratch_mask_, cv::CMP_LT);
+    cv::compare(v, cv::Scalar(cfg.WHITE_V_MIN), white_mask, cv::CMP_GE);
+    cv::bitwise_and(white_mask, scratch_mask_, white_mask);
+    cv::bitwise_and(white_mask, valid_mask_, white_mask);
+
+    // 노란색: 흰색이 아니면서 YELLOW_H_MIN <= h <= YELLOW_H_MAX
+    cv::inRange(h, cv::Scalar(cfg.YELLOW_H_MIN), cv::Scalar(cfg.YELLOW_H_MAX), yellow_mask);
+    cv::bitwise_and(yellow_mask, valid_mask_, yellow_mask);
+    cv::bitwise_not(white_mask, scratch_mask_);
+    cv::bitwise_and(yellow_mask, scratch_mask_, yellow_mask);
+
+    // 흰색=255, 노란색=127
+    grayscale.create(v.size(), CV_8UC1);
+    grayscale.setTo(0);
+    grayscale.setTo(255, white_mask);
+    grayscale.setTo(127, yellow_mask);
+}
+
+cv::Mat FramePreprocessor::createTrapezoidMask(int height, int width) {
+    cv::Mat mask = cv::Mat::zeros(height, width, CV_8UC1);
+
+    int y_top = static_cast<int>(height * Y_TOP);
+    int x_center = width / 2;
+    int long_half = width * LONG_HALF;
+    int short_half = static_cast<int>(width * SHORT_HALF);
+
+    std::vector<cv::Point> pts = {
+        {x_center - long_half, height},
+        {x_center + long_half, height},
+        {x_center + short_half, y_top},
+        {x_center - short_half, y_top}
+    };
+
+    cv::fillConvexPoly(mask, pts, 255);
+    return mask;
+}
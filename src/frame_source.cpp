@@ -0,0 +1,72 @@
+#include "frame_source.hpp"
+#include <linux/videodev2.h>
+
+uint32_t fourccFromString(const std::string& name) {
+    if (name.size() != 4) return 0;
+    return v4l2_fourcc(name[0], name[1], name[2], name[3]);
+}
+
+std::string fourccToString(uint32_t fourcc) {
+    if (fourcc == 0) return "BGR";
+    std::string name(4, ' ');
+    for (int i = 0; i < 4; ++i) name[i] = static_cast<char>((fourcc >> (8 * i)) & 0xFF);
+    return name;
+}
+
+int bytesPerPixel(uint32_t fourcc) {
+    switch (fourcc) {
+    case 0:
+    case V4L2_PIX_FMT_BGR24:
+        return 3;
+    case V4L2_PIX_FMT_YUYV:
+        return 2;
+    case V4L2_PIX_FMT_SBGGR8:
+    case V4L2_PIX_FMT_SGBRG8:
+    case V4L2_PIX_FMT_SGRBG8:
+    case V4L2_PIX_FMT_SRGGB8:
+    case V4L2_PIX_FMT_GREY:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+bool convertToBgr(const CapturedFrame& in, cv::Mat& bgr) {
+    // OpenCV Bayer 코드는 패턴 이름이 V4L2 와 반대 방향 (BGGR -> BayerRG)
+    switch (in.fourcc) {
+    case 0:
+    case V4L2_PIX_FMT_BGR24:
+        bgr = in.image;
+        return true;
+    case V4L2_PIX_FMT_YUYV:
+        cv::cvtColor(in.image, bgr, cv::COLOR_YUV2BGR_YUYV);
+        return true;
+    case V4L2_PIX_FMT_SBGGR8:
+        cv::cvtColor(in.image, bgr, cv::COLOR_BayerRG2BGR);
+        return true;
+    case V4L2_PIX_FMT_SGBRG8:
+        cv::cvtColor(in.image, bgr, cv::COLOR_BayerGR2BGR);
+        return true;
+    case V4L2_PIX_FMT_SGRBG8:
+        cv::cvtColor(in.image, bgr, cv::COLOR_BayerGB2BGR);
+        return true;
+    case V4L2_PIX_FMT_SRGGB8:
+        cv::cvtColor(in.image, bgr, cv::COLOR_BayerBG2BGR);
+        return true;
+    case V4L2_PIX_FMT_GREY:
+        cv::cvtColor(in.image, bgr, cv::COLOR_GRAY2BGR);
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool bayerRedOffset(uint32_t fourcc, int& red_x, int& red_y) {
+    switch (fourcc) {
+    case V4L2_PIX_FMT_SBGGR8: red_x = 1; red_y = 1; return true;
+    case V4L2_PIX_FMT_SGBRG8: red_x = 0; red_y = 1; return true;
+    case V4L2_PIX_FMT_SGRBG8: red_x = 1; red_y = 0; return true;
+    case V4L2_PIX_FMT_SRGGB8: red_x = 0; red_y = 0; return true;
+    default: return false;
+    }
+}
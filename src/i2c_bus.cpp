@@ -0,0 +1,60 @@
+#include "i2c_bus.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <linux/i2c-dev.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+LinuxI2cBus::LinuxI2cBus(const std::string& device, int address) : device_(device), address_(address) {}
+
+LinuxI2cBus::~LinuxI2cBus() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+bool LinuxI2cBus::open() {
+    fd_ = ::open(device_.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd_ < 0) {
+        std::cerr << "[ERROR] I2C 장치 열기 실패: " << device_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return false;
+    }
+    if (ioctl(fd_, I2C_SLAVE, address_) < 0) {
+        std::cerr << "[ERROR] I2C 주소 0x" << std::hex << address_ << std::dec << " 지정 실패: "
+                  << std::strerror(errno) << std::endl;
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    return true;
+}
+
+bool LinuxI2cBus::write(const uint8_t* data, size_t length) {
+    if (fd_ < 0) return false;
+    ssize_t written = ::write(fd_, data, length);
+    if (written != static_cast<ssize_t>(length)) {
+        std::cerr << "[WARN] I2C 쓰기 실패: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+FakeI2cBus::FakeI2cBus() : history_(HISTORY) {}
+
+bool FakeI2cBus::write(const uint8_t* data, size_t length) {
+    if (length == 0) return false;
+    Transaction& t = history_[count_ % HISTORY];
+    t.length = std::min(length, MAX_TRANSACTION);
+    std::copy(data, data + t.length, t.bytes);
+    ++count_;
+
+    // 첫 바이트 레지스터부터 연속 기록 (자동 증가)
+    uint8_t reg = data[0];
+    for (size_t i = 1; i < length; ++i) registers_[reg++] = data[i];
+    return true;
+}
+
+const FakeI2cBus::Transaction& FakeI2cBus::recent(size_t age) const {
+    return history_[(count_ - 1 - age) % HISTORY];
+}
@@ -1,113 +1,155 @@
 #include "lane_detector.hpp"
 #include "constants.hpp"
+#include "config.hpp"
 #include <iostream>
-#include <numeric>
+#include <array>
 #include <cmath>
+#include <algorithm>
 
-LaneDetector::LaneDetector() {}
-
-std::vector<std::vector<int>> LaneDetector::findBlobs(const uchar* row_ptr, int width, int min_blob_size) {
-    std::vector<std::vector<int>> blobs;
-    std::vector<int> current_blob;
-
-    for (int x = 0; x < width; ++x) {
-        if (row_ptr[x]) {
-            current_blob.push_back(x);
-        } else if (!current_blob.empty()) {
-            if (current_blob.size() >= min_blob_size)
-                blobs.push_back(current_blob);
-            current_blob.clear();
-        }
-    }
+LaneDetector::LaneDetector()
+    : roi_remove_left_(config().ROI_REMOVE_LEFT), white_line_drive_(config().WHITE_LINE_DRIVE) {
+    // 프레임 크기 기준 작업 버퍼 미리 확보 (프레임마다 재할당 없음)
+    warped_mask_.create(FRAME_HEIGHT, FRAME_WIDTH, CV_8UC1);
+    left_ts_.reserve(LANE_FIT_ROWS);
+    left_xs_.reserve(LANE_FIT_ROWS);
+    right_ts_.reserve(LANE_FIT_ROWS);
+    right_xs_.reserve(LANE_FIT_ROWS);
+}
 
-    // 가장 왼쪽 차선과 가장 오른쪽 차선 블롭 선택
-    std::vector<std::vector<int>> result;
-    if (!blobs.empty()) {
-        auto left_it = std::min_element(blobs.begin(), blobs.end(), [](const auto& a, const auto& b) {
-            return a.front() < b.front();
-        });
-        auto right_it = std::max_element(blobs.begin(), blobs.end(), [](const auto& a, const auto& b) {
-            return a.back() < b.back();
-        });
-        int mid = width / 2;
-        // left_it이 화면 오른쪽에 있거나 right_it이 화면 왼쪽에 있으면 제외
-        if (left_it->front() < mid) {
-            result.push_back(*left_it);
-        }
-        if (right_it->back() > mid) {
-            result.push_back(*right_it);
-        }
+cv::Range LaneDetector::requiredRows(int height) {
+    // 노란 픽셀 수는 사다리꼴 ROI (Y_TOP 아래) 전체에서 셈
+    float top = Y_TOP;
+    if (IPM_ENABLE) {
+        // 평면도 변환은 IPM_SRC_POINTS 사다리꼴 안의 원본 행만 샘플링
+        for (size_t i = 1; i < IPM_SRC_POINTS.size(); i += 2) top = std::min(top, IPM_SRC_POINTS[i]);
+    } else if (LANE_MODEL == "fit") {
+        top = std::min(top, LANE_FIT_Y1);
+    } else {
+        top = std::min(top, LANE_TWO_ROW_Y[0]);
     }
-    return result;
+    return cv::Range(std::clamp(static_cast<int>(height * top), 0, height), height);
 }
 
-
-int LaneDetector::process(const cv::Mat& frame, cv::Mat& vis_out) {
+int LaneDetector::process(const PreprocessedFrame& input, DebugOverlay& overlay) {
+    const cv::Mat& frame = input.frame;
     if (frame.empty()) {
         std::cerr << "[LaneDetector] 입력 프레임이 비어있습니다." << std::endl;
         return 0;
     }
 
-    cv::Mat hsv;
-    cv::cvtColor(frame, hsv, cv::COLOR_BGR2HSV);
-    std::vector<cv::Mat> channels;
-    cv::split(hsv, channels);
-    const cv::Mat& h = channels[0];
-    const cv::Mat& s = channels[1];
-    const cv::Mat& v = channels[2];
-
+    const Config& cfg = config();
     int height = frame.rows;
     int width = frame.cols;
     int center_x = width / 2;
 
-    // 관심영역 마스크
-    cv::Mat roi_mask = createTrapezoidMask(height, width);
-    cv::Mat valid_mask = (v >= VALID_V_MIN) & roi_mask;
-    cv::Mat white_mask = (s < WHITE_S_MAX) & (v >= WHITE_V_MIN) & valid_mask;
-    cv::Mat yellow_mask = valid_mask & (~white_mask) & (h >= YELLOW_H_MIN) & (h <= YELLOW_H_MAX);
+    // 전처리 단계에서 계산된 마스크 사용
+    const cv::Mat& white_mask = input.white_mask;
+    const cv::Mat& yellow_mask = input.yellow_mask;
+
+    // 좌측 ROI 제거: x <= ROI_REMOVE_LEFT_X_THRESHOLD 구간은 무시
+    int x_start = roi_remove_left_ ? std::clamp(cfg.ROI_REMOVE_LEFT_X_THRESHOLD + 1, 0, width) : 0;
+
+    // 두 행 모드: 프레임 크기/주행 모드에 맞는 특수화 커널로 노란 픽셀 수와 탐색 행 blob 을 한 번에 계산
+    // (추적 중인 행은 창 탐색을 먼저 하므로 스캔에서 제외)
+    LaneScanFn kernel = (IPM_ENABLE || LANE_MODEL == "fit")
+        ? nullptr : lane_kernels_.get(width, height, white_line_drive_, roi_remove_left_);
+    LaneScan scan;
+    unsigned scan_rows = 0;
+    if (kernel) {
+        for (int i = 0; i < 2; ++i) {
+            if (!(LANE_TRACKING && tracks_[i].active)) scan_rows |= 1u << i;
+        }
+        kernel(input, x_start, scan_rows, scan);
+        yellow_pixel_count_ = scan.yellow_pixel_count;
+    } else {
+        // 분류하지 않은 행은 0 이므로 분류한 행만 셈
+        const int y_begin = std::clamp(input.classified_rows.start, 0, height);
+        const int y_end = std::clamp(input.classified_rows.end, y_begin, height);
+        yellow_pixel_count_ = cv::countNonZero(yellow_mask(cv::Range(y_begin, y_end), cv::Range(x_start, width)));
+    }
+
+    // 주행 차선 색상 마스크
+    const cv::Mat* lane_mask = white_line_drive_ ? &white_mask : &yellow_mask;
 
-    // if (VIEWER) {
-    //     cv::imshow("roi_mask", roi_mask);
-    //     cv::waitKey(1);
-    // }
+    // bird's-eye 모드: 차선 마스크만 평면도로 변환 (좌측 제거는 remap 테이블에 반영됨)
+    if (IPM_ENABLE) {
+        birdseye_.rebuildIfNeeded(lane_mask->size());
+        birdseye_.warp(*lane_mask, warped_mask_, roi_remove_left_);
+        lane_mask = &warped_mask_;
+        x_start = 0;
+        overlay.reset(warped_mask_); // 시각화도 평면도 좌표로 표시
+    } else {
+        overlay.reset(frame);
+    }
 
-    vis_out = frame.clone();
-    std::vector<int> target_rows = { static_cast<int>(height * 0.35f), static_cast<int>(height * 0.65f) };
-    std::vector<cv::Point> lane_points;
+    // 다중 행 모델 피팅 모드
+    if (LANE_MODEL == "fit") {
+        return processFit(*lane_mask, x_start, overlay);
+    }
 
-    for (int y : target_rows) {
-        const uchar* row_ptr = (WHITE_LINE_DRIVE ? white_mask.ptr<uchar>(y) : yellow_mask.ptr<uchar>(y));
-        auto blobs = findBlobs(row_ptr, width);
+    const int target_rows[2] = { static_cast<int>(height * LANE_TWO_ROW_Y[0]), static_cast<int>(height * LANE_TWO_ROW_Y[1]) };
+    std::array<cv::Point, 4> lane_points; // [위 왼쪽, 위 오른쪽, 아래 왼쪽, 아래 오른쪽]
 
-        if (blobs.size() >= 2) {
-            int x1 = std::accumulate(blobs[0].begin(), blobs[0].end(), 0) / blobs[0].size();
-            int x2 = std::accumulate(blobs[1].begin(), blobs[1].end(), 0) / blobs[1].size();
+    for (int i = 0; i < 2; ++i) {
+        int y = target_rows[i];
+        const uchar* row_ptr = lane_mask->ptr<uchar>(y);
+        cv::Point& p1 = lane_points[2 * i];
+        cv::Point& p2 = lane_points[2 * i + 1];
+
+        // 추적 모드: 직전 차선 위치 주변 창만 탐색, 실패 시 전체 스캔으로 복귀
+        int tx1 = 0, tx2 = 0;
+        if (LANE_TRACKING && tracks_[i].active && trackRow(row_ptr, width, x_start, i, tx1, tx2)) {
+            p1 = cv::Point(tx1, y);
+            p2 = cv::Point(tx2, y);
+            overlay.circle(p1, 3, cv::Scalar(0, 255, 0), -1);
+            overlay.circle(p2, 3, cv::Scalar(0, 255, 0), -1);
+            continue;
+        }
+
+        int blob_x[2];
+        int blob_count;
+        if (scan_rows & (1u << i)) {
+            blob_count = scan.blob_count[i];
+            blob_x[0] = scan.blob_x[i][0];
+            blob_x[1] = scan.blob_x[i][1];
+        } else {
+            blob_count = scanLaneRow<0>(row_ptr, width, x_start, blob_x);
+        }
+
+        if (blob_count >= 2) {
+            int x1 = blob_x[0];
+            int x2 = blob_x[1];
             if (x1 > x2) std::swap(x1, x2);
-            lane_points.emplace_back(x1, y);
-            lane_points.emplace_back(x2, y);
-            cv::circle(vis_out, cv::Point(x1, y), 3, cv::Scalar(0, 255, 255), -1);
-            cv::circle(vis_out, cv::Point(x2, y), 3, cv::Scalar(0, 255, 255), -1);
-        } else if (blobs.size() == 1) {
-            int x = std::accumulate(blobs[0].begin(), blobs[0].end(), 0) / blobs[0].size();
-            // 원근감 반영한 동적 차간 간격
+            p1 = cv::Point(x1, y);
+            p2 = cv::Point(x2, y);
+
+            // 양쪽 차선을 모두 찾은 경우에만 추적 시작
+            if (LANE_TRACKING) {
+                tracks_[i] = {true, x1, x2, 0};
+                (i == 0 ? prev_lane_gap_top_ : prev_lane_gap_bottom_) = x2 - x1;
+            }
+        } else if (blob_count == 1) {
+            int x = blob_x[0];
+            // 원근감 반영한 동적 차간 간격 (bird's-eye 모드에서는 고정 간격)
             float ratio = static_cast<float>(y) / static_cast<float>(height);
-            int lane_gap = static_cast<int>(DEFAULT_LANE_GAP * ratio);
+            int lane_gap = IPM_ENABLE ? IPM_LANE_GAP : static_cast<int>(cfg.DEFAULT_LANE_GAP * ratio);
             int x_other = (x < center_x) ? x + lane_gap : x - lane_gap;
-            lane_points.emplace_back(x, y);
-            lane_points.emplace_back(x_other, y);
-            cv::circle(vis_out, cv::Point(x, y), 3, cv::Scalar(0, 255, 255), -1);
-            cv::circle(vis_out, cv::Point(x_other, y), 3, cv::Scalar(0, 255, 255), -1);
+            p1 = cv::Point(x, y);
+            p2 = cv::Point(x_other, y);
         } else {
-            lane_points.emplace_back(center_x - 60, y);
-            lane_points.emplace_back(center_x + 60, y);
+            p1 = cv::Point(center_x - 60, y);
+            p2 = cv::Point(center_x + 60, y);
+            continue;
         }
+        overlay.circle(p1, 3, cv::Scalar(0, 255, 255), -1);
+        overlay.circle(p2, 3, cv::Scalar(0, 255, 255), -1);
     }
 
     // 오프셋 및 차선 교점 가중 합산
     float offset_sum = 0;
     for (const auto& pt : lane_points)
         offset_sum += (pt.x - center_x);
-    float avg_offset = offset_sum / lane_points.size();
+    float avg_offset = offset_sum / static_cast<float>(lane_points.size());
 
     // 좌/우 차선 선형 교점 계산
     cv::Point2f p_left1 = lane_points[0];
@@ -125,39 +167,186 @@ int LaneDetector::process(const cv::Mat& frame, cv::Mat& vis_out) {
     }
 
     // 최종 제어 신호
-    float control = avg_offset * AVG_PARAM + inter_offset * INTER_PARAM;
+    float control = avg_offset * cfg.AVG_PARAM + inter_offset * cfg.INTER_PARAM;
+
+    // 두 행의 중심점으로 기울기만 추정 (곡률은 피팅 모드에서만 제공)
+    float center_top = (lane_points[0].x + lane_points[1].x) * 0.5f;
+    float center_bottom = (lane_points[2].x + lane_points[3].x) * 0.5f;
+    estimate_.offset = control;
+    estimate_.heading = (center_top - center_bottom) / static_cast<float>(target_rows[1] - target_rows[0]);
+    estimate_.curvature = 0.0f;
 
     // 디버그 텍스트
-    cv::putText(vis_out, "avg: " + std::to_string(avg_offset), cv::Point(10, 30),
-                cv::FONT_HERSHEY_SIMPLEX, 0.6, cv::Scalar(255, 0, 255), 2);
-    cv::putText(vis_out, "int: " + std::to_string(inter_offset), cv::Point(10, 50),
-                cv::FONT_HERSHEY_SIMPLEX, 0.6, cv::Scalar(255, 0, 255), 2);
+    overlay.text("avg: ", avg_offset, cv::Point(10, 30), 0.6, cv::Scalar(255, 0, 255), 2);
+    overlay.text("int: ", inter_offset, cv::Point(10, 50), 0.6, cv::Scalar(255, 0, 255), 2);
+
+    return static_cast<int>(control);
+}
+
+int LaneDetector::extractRuns(const uchar* row_ptr, int width, int x_start, int min_blob_size) {
+    int count = 0;
+    int x = x_start;
+    while (x < width && count < MAX_RUNS_PER_ROW) {
+        if (!row_ptr[x]) { ++x; continue; }
+        int start = x;
+        while (x < width && row_ptr[x]) ++x;
+        if (x - start >= min_blob_size) {
+            row_runs_[count++] = {start, x - 1};
+        }
+    }
+    return count;
+}
+
+int LaneDetector::processFit(const cv::Mat& mask, int x_start, DebugOverlay& overlay) {
+    const Config& cfg = config();
+    int height = mask.rows;
+    int width = mask.cols;
+    int center_x = width / 2;
+
+    int y_begin = static_cast<int>(height * LANE_FIT_Y1);
+    int y_end = std::min(static_cast<int>(height * LANE_FIT_Y2), height - 1);
+    int rows = std::max(LANE_FIT_ROWS, 2);
+    float y_eval = (y_begin + y_end) * 0.5f; // 샘플 구간 중앙에서 모델 평가
+
+    left_ts_.clear();  left_xs_.clear();
+    right_ts_.clear(); right_xs_.clear();
+
+    for (int r = 0; r < rows; ++r) {
+        int y = y_begin + (y_end - y_begin) * r / (rows - 1);
+        int n = extractRuns(mask.ptr<uchar>(y), width, x_start);
+        if (n == 0) continue;
+
+        // scanLaneRow 와 같은 기준: 가장 왼쪽 run은 중앙 왼쪽, 가장 오른쪽 run은 중앙 오른쪽일 때만 사용
+        // run이 하나뿐이면 중심 위치로 좌/우 한쪽에만 배정
+        const RowRun& first = row_runs_[0];
+        const RowRun& last = row_runs_[n - 1];
+        int first_x = (first.start + first.end) / 2;
+        int last_x = (last.start + last.end) / 2;
+        bool use_left = first.start < center_x && (n >= 2 || first_x < center_x);
+        bool use_right = last.end > center_x && (n >= 2 || last_x >= center_x);
+
+        float t = (y - y_eval) / static_cast<float>(height);
+        if (use_left) {
+            left_ts_.push_back(t);
+            left_xs_.push_back(first_x);
+            overlay.circle(cv::Point(first_x, y), 2, cv::Scalar(0, 255, 255), -1);
+        }
+        if (use_right) {
+            right_ts_.push_back(t);
+            right_xs_.push_back(last_x);
+            overlay.circle(cv::Point(last_x, y), 2, cv::Scalar(0, 255, 255), -1);
+        }
+    }
+
+    // 좌/우 차선 각각 최소제곱 피팅: x = c0 + c1*t + c2*t^2, t = (y - y_eval) / height
+    int order = std::clamp(LANE_FIT_ORDER, 1, 2);
+    double left_c[3], right_c[3];
+    bool has_left = fitPolynomial(left_ts_, left_xs_, order, left_c);
+    bool has_right = fitPolynomial(right_ts_, right_xs_, order, right_c);
+
+    // 차선 중심선 계수 (한쪽만 있으면 원근 반영 간격 DEFAULT_LANE_GAP * y / height 의 절반만큼 이동,
+    // bird's-eye 모드에서는 고정 간격 IPM_LANE_GAP 의 절반만큼 평행 이동)
+    double center_c[3] = {static_cast<double>(center_x), 0.0, 0.0};
+    float half_gap_eval = IPM_ENABLE ? 0.5f * IPM_LANE_GAP : 0.5f * cfg.DEFAULT_LANE_GAP * y_eval / height;
+    float half_gap_slope = IPM_ENABLE ? 0.0f : 0.5f * cfg.DEFAULT_LANE_GAP; // d(half_gap)/dt
+    if (has_left && has_right) {
+        for (int k = 0; k < 3; ++k) center_c[k] = 0.5 * (left_c[k] + right_c[k]);
+    } else if (has_left) {
+        center_c[0] = left_c[0] + half_gap_eval;
+        center_c[1] = left_c[1] + half_gap_slope;
+        center_c[2] = left_c[2];
+    } else if (has_right) {
+        center_c[0] = right_c[0] - half_gap_eval;
+        center_c[1] = right_c[1] - half_gap_slope;
+        center_c[2] = right_c[2];
+    }
+
+    float center_offset = static_cast<float>(center_c[0]) - center_x;
+    float control = center_offset * cfg.AVG_PARAM;
+    estimate_.offset = control;
+    estimate_.heading = static_cast<float>(-center_c[1] / height);
+    estimate_.curvature = static_cast<float>(2.0 * center_c[2] / (static_cast<double>(height) * height));
+
+    // 디버그 표시: 피팅된 중심선
+    for (int r = 0; r < rows; ++r) {
+        int y = y_begin + (y_end - y_begin) * r / (rows - 1);
+        double t = (y - y_eval) / height;
+        int x = static_cast<int>(center_c[0] + center_c[1] * t + center_c[2] * t * t);
+        overlay.circle(cv::Point(x, y), 2, cv::Scalar(255, 0, 255), -1);
+    }
+    overlay.text("off: ", center_offset, cv::Point(10, 30), 0.6, cv::Scalar(255, 0, 255), 2);
+    overlay.text("head: ", estimate_.heading, cv::Point(10, 50), 0.6, cv::Scalar(255, 0, 255), 2);
 
-    yellow_pixel_count_ = cv::countNonZero(yellow_mask);
     return static_cast<int>(control);
 }
 
+bool LaneDetector::findBlobNear(const uchar* row_ptr, int width, int x_start, int center, int& x_out, int min_blob_size) {
+    const int window = config().LANE_TRACK_WINDOW;
+    int lo = std::max(x_start, center - window);
+    int hi = std::min(width - 1, center + window);
+    if (lo > hi) return false;
+
+    // 창 왼쪽 경계에 걸친 blob은 시작점까지 되돌아감
+    int x = lo;
+    while (x > x_start && row_ptr[x] && row_ptr[x - 1]) --x;
+
+    int best_dist = width;
+    bool found = false;
+    while (x <= hi) {
+        if (!row_ptr[x]) { ++x; continue; }
+        int start = x;
+        while (x < width && row_ptr[x]) ++x; // 창 오른쪽 경계를 넘는 blob도 끝까지 포함
+        int end = x - 1;
+        if (end - start + 1 >= min_blob_size) {
+            int cx = (start + end) / 2;
+            int dist = std::abs(cx - center);
+            if (dist < best_dist) {
+                best_dist = dist;
+                x_out = cx;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+bool LaneDetector::trackRow(const uchar* row_ptr, int width, int x_start, int row_index, int& x1, int& x2) {
+    LaneTrack& track = tracks_[row_index];
+    int& lane_gap = (row_index == 0) ? prev_lane_gap_top_ : prev_lane_gap_bottom_;
+
+    int left = 0, right = 0;
+    bool has_left = findBlobNear(row_ptr, width, x_start, track.left_x, left);
+    bool has_right = findBlobNear(row_ptr, width, x_start, track.right_x, right);
+    if (has_left && has_right && left >= right) {
+        has_left = has_right = false; // 두 창이 같은 blob을 잡은 경우
+    }
+
+    if (!has_left && !has_right) {
+        // 일정 프레임 연속 실패 시 추적 해제 → 전체 스캔
+        if (++track.misses > config().LANE_TRACK_MAX_MISSES) {
+            track.active = false;
+            return false;
+        }
+        x1 = track.left_x;
+        x2 = track.right_x;
+        return true;
+    }
+
+    // 한쪽만 찾으면 직전에 측정한 차선 간격으로 반대쪽 추정
+    if (has_left && has_right) lane_gap = right - left;
+    else if (has_left)         right = left + lane_gap;
+    else                       left = right - lane_gap;
+
+    track = {true, left, right, 0};
+    x1 = left;
+    x2 = right;
+    return true;
+}
+
 int LaneDetector::getYellowPixelCount() const {
     return yellow_pixel_count_;
 }
 
-cv::Mat LaneDetector::createTrapezoidMask(int height, int width) {
-    cv::Mat mask = cv::Mat::zeros(height, width, CV_8UC1);
-    int y_top = static_cast<int>(height * Y_TOP);
-    int x_center = width / 2;
-    int long_half = width * LONG_HALF;
-    int short_half = static_cast<int>(width * SHORT_HALF);
-    std::vector<cv::Point> pts = {
-        {x_center - long_half, height}, 
-        {x_center + long_half, height}, 
-        {x_center + short_half, y_top}, 
-        {x_center - short_half, y_top}};
-    cv::fillConvexPoly(mask, pts, 255);
-    if (ROI_REMOVE_LEFT)
-        cv::rectangle(mask, 
-            cv::Point(0, 0), 
-            cv::Point(ROI_REMOVE_LEFT_X_THRESHOLD, height), 
-            0, 
-            cv::FILLED);
-    return mask;
+LaneEstimate LaneDetector::getLaneEstimate() const {
+    return estimate_;
 }
@@ -0,0 +1,87 @@
+#include "lane_kernels.hpp"
+#include "constants.hpp"
+#include <iostream>
+#include <algorithm>
+
+namespace {
+
+// 노란 픽셀 수 (행 길이 고정, 전처리가 분류한 행만)
+// - 16바이트 블록 단위로 세어 -O2 에서도 벡터화되도록 함 (x_start 를 블록 경계로 내린 뒤 앞부분만 빼서 보정)
+// - 좌측 ROI 제거를 끈 커널은 x_start = 0 상수라 보정 루프가 사라짐
+template <int W, int H>
+int countNonZeroFixed(const cv::Mat& mask, cv::Range rows, int x_start) {
+    static_assert(W % 16 == 0, "행 길이는 16의 배수여야 함");
+    const int y_begin = std::clamp(rows.start, 0, H);
+    const int y_end = std::clamp(rows.end, y_begin, H);
+    const int x_block = x_start & ~15;
+    int count = 0;
+    for (int y = y_begin; y < y_end; ++y) {
+        const uchar* row = mask.ptr<uchar>(y);
+        int row_count = 0;
+        for (int b = x_block; b < W; b += 16) {
+            int block_count = 0;
+            for (int k = 0; k < 16; ++k) block_count += row[b + k] != 0;
+            row_count += block_count;
+        }
+        for (int x = x_block; x < x_start; ++x) row_count -= row[x] != 0;
+        count += row_count;
+    }
+    return count;
+}
+
+template <int W, int H, bool WHITE_LINE_DRIVE, bool ROI_REMOVE_LEFT>
+void scanLane(const PreprocessedFrame& input, int x_start, unsigned rows, LaneScan& out) {
+    static_assert(W > 0 && H > 0, "특수화 커널은 프레임 크기가 고정되어야 함");
+    constexpr int ROW_Y[2] = { static_cast<int>(H * LANE_TWO_ROW_Y[0]), static_cast<int>(H * LANE_TWO_ROW_Y[1]) };
+    if (!ROI_REMOVE_LEFT) x_start = 0;
+
+    out.yellow_pixel_count = countNonZeroFixed<W, H>(input.yellow_mask, input.classified_rows, x_start);
+
+    const cv::Mat& lane_mask = WHITE_LINE_DRIVE ? input.white_mask : input.yellow_mask;
+    for (int i = 0; i < 2; ++i) {
+        out.row_y[i] = ROW_Y[i];
+        out.blob_count[i] = (rows & (1u << i))
+            ? scanLaneRow<W>(lane_mask.ptr<uchar>(ROW_Y[i]), W, x_start, out.blob_x[i]) : 0;
+    }
+}
+
+// 프레임 크기별 커널 묶음: kernels[white_line_drive][roi_remove_left]
+struct KernelSet {
+    int width;
+    int height;
+    LaneScanFn kernels[2][2];
+};
+
+template <int W, int H>
+constexpr KernelSet kernelSet() {
+    return {W, H, {{&scanLane<W, H, false, false>, &scanLane<W, H, false, true>},
+                   {&scanLane<W, H, true, false>, &scanLane<W, H, true, true>}}};
+}
+
+// 특수화할 프레임 크기 (배포 기하 320x200, 다른 주행 크기는 여기에 추가)
+constexpr KernelSet KERNEL_SETS[] = {
+    kernelSet<320, 200>(),
+};
+
+} // namespace
+
+LaneScanFn findLaneKernel(int width, int height, bool white_line_drive, bool roi_remove_left) {
+    for (const KernelSet& set : KERNEL_SETS) {
+        if (set.width == width && set.height == height) return set.kernels[white_line_drive][roi_remove_left];
+    }
+    return nullptr;
+}
+
+void LaneKernelDispatcher::select(int width, int height, bool white_line_drive, bool roi_remove_left) {
+    const bool size_changed = !selected_ || width != width_ || height != height_;
+    selected_ = true;
+    width_ = width;
+    height_ = height;
+    white_line_drive_ = white_line_drive;
+    roi_remove_left_ = roi_remove_left;
+
+    kernel_ = (LANE_KERNEL == "specialized") ? findLaneKernel(width, height, white_line_drive, roi_remove_left) : nullptr;
+    if (size_changed && LANE_KERNEL == "specialized" && !kernel_) {
+        std::cerr << "[WARN] " << width << "x" << height << " 크기의 특수화 차선 커널이 없어 범용 경로 사용" << std::endl;
+    }
+}
@@ -0,0 +1,48 @@
+#include "lane_model.hpp"
+#include <cmath>
+#include <utility>
+
+bool fitPolynomial(const std::vector<float>& ts, const std::vector<float>& xs, int order, double coeffs[3]) {
+    const int n = order + 1;
+    coeffs[0] = coeffs[1] = coeffs[2] = 0.0;
+    if (order < 1 || order > 2 || static_cast<int>(ts.size()) < n) return false;
+
+    // 정규방정식 A c = b 구성 (A[i][j] = Σ t^(i+j), b[i] = Σ x t^i)
+    double sum_t[5] = {0, 0, 0, 0, 0};
+    double sum_xt[3] = {0, 0, 0};
+    for (size_t k = 0; k < ts.size(); ++k) {
+        double p = 1.0;
+        for (int e = 0; e <= 2 * order; ++e) {
+            sum_t[e] += p;
+            if (e <= order) sum_xt[e] += xs[k] * p;
+            p *= ts[k];
+        }
+    }
+
+    double a[3][4];
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) a[i][j] = sum_t[i + j];
+        a[i][n] = sum_xt[i];
+    }
+
+    // 부분 피벗 가우스 소거
+    for (int col = 0; col < n; ++col) {
+        int pivot = col;
+        for (int r = col + 1; r < n; ++r)
+            if (std::abs(a[r][col]) > std::abs(a[pivot][col])) pivot = r;
+        if (std::abs(a[pivot][col]) < 1e-9) return false;
+        if (pivot != col)
+            for (int j = 0; j <= n; ++j) std::swap(a[pivot][j], a[col][j]);
+
+        for (int r = col + 1; r < n; ++r) {
+            double f = a[r][col] / a[col][col];
+            for (int j = col; j <= n; ++j) a[r][j] -= f * a[col][j];
+        }
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        double v = a[i][n];
+        for (int j = i + 1; j < n; ++j) v -= a[i][j] * coeffs[j];
+        coeffs[i] = v / a[i][i];
+    }
+    return true;
+}
@@ -0,0 +1,49 @@
+#include "latency_stats.hpp"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+
+int64_t monotonicNs() {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+LatencyStats::LatencyStats(size_t capacity) : samples_(std::max<size_t>(capacity, 1), 0.0) {}
+
+void LatencyStats::add(double ms) {
+    samples_[next_] = ms;
+    next_ = (next_ + 1) % samples_.size();
+    ++count_;
+    sum_ += ms;
+    sum_sq_ += ms * ms;
+    max_ = std::max(max_, ms);
+}
+
+void LatencyStats::addSince(int64_t start_ns) {
+    if (start_ns <= 0) return;
+    add((monotonicNs() - start_ns) / 1e6);
+}
+
+void LatencyStats::report(const std::string& label) const {
+    if (count_ == 0) {
+        std::cout << "[INFO] " << label << ": 표본 없음\n";
+        return;
+    }
+    // 백분위는 보관 중인 최근 표본 기준
+    std::vector<double> sorted(samples_.begin(), samples_.begin() + std::min(count_, samples_.size()));
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&](double p) { return sorted[static_cast<size_t>(p * (sorted.size() - 1))]; };
+    const double mean = sum_ / count_;
+    const double stddev = std::sqrt(std::max(sum_sq_ / count_ - mean * mean, 0.0));
+
+    std::cout << "[INFO] " << label << std::fixed << std::setprecision(2)
+              << ": n=" << count_
+              << " | 평균 " << mean
+              << " | 표준편차 " << stddev
+              << " | p50 " << percentile(0.50)
+              << " | p99 " << percentile(0.99)
+              << " | 최대 " << max_ << " ms\n";
+}
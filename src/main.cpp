@@ -11,40 +11,46 @@
 #include <ctime> // 시간 변환
 #include <iomanip> // 입출력 포맷 조정
 #include <sstream> // 문자열 스트림 처리
+#include <algorithm> // std::clamp, std::min/max
 
 #include "usb_cam.hpp" // USB 카메라 래퍼 클래스
 #include "video_recorder.hpp" // 비디오 녹화 클래스
+#include "frame_preprocessor.hpp" // 프레임 공통 전처리 클래스
+#include "frame_channel.hpp" // 최신 프레임 전달 채널
 #include "lane_detector.hpp" // 차선 검출 클래스
 #include "object_detector.hpp" // 객체 검출 클래스
+#include "perception_graph.hpp" // 프레임 단위 검출 작업 그래프
 #include "control.hpp" // 조향 제어 클래스
 #include "constants.hpp" // 상수 정의 및 로드
+#include "config.hpp" // 실행 중 바꿀 수 있는 튜닝 값
+#include "config_watcher.hpp" // constants.json 변경 감지 후 재적용
+#include "benchmark.hpp" // 인식 단계 벤치마크
+#include "latency_stats.hpp" // 캡처 -> 제어 지연 집계
+#include "result_joiner.hpp" // 검출 결과 프레임 단위 합류
+#include "thread_profile.hpp" // 스레드 CPU 고정/우선순위, 메모리 고정
+#include "periodic_timer.hpp" // 고정 주기 제어 루프 타이머
+#include "offset_extrapolator.hpp" // 차선 오프셋 외삽
 
 // 전역 변수 선언
-static std::mutex frame_mutex; // 프레임 공유 시 동기화용 뮤텍스
-static std::shared_ptr<cv::Mat> shared_frame = nullptr; // 최신 프레임 저장 포인터
+static constexpr std::chrono::milliseconds FRAME_WAIT_TIMEOUT(100); // 종료 확인 주기
 
-static std::mutex lane_mutex; // 차선 오프셋 동기화용 뮤텍스
-static std::atomic<int> mean_center_offset{0}; // 차선 중심 오프셋 (원자 변수)
-std::atomic<int> yellow_pixel_count{0};  // lane_detector의 결과를 공유
 
-static std::mutex object_mutex; // 객체 검출 플래그 동기화용 뮤텍스
-static std::vector<bool> detections_flags(3, false); // 객체 검출 결과 플래그 (stop, cross, start)
-
-static std::condition_variable control_cv; // 제어 스레드 알림용 조건 변수
-static std::mutex control_mutex; // 제어 조건 변수용 뮤텍스
-static bool control_ready = false; // 제어 가능 상태 플래그
-
-static std::condition_variable first_frame_cv; // 첫 번째 프레임 대기용 조건 변수
-static bool first_frame_ready = false; // 첫 번째 프레임 수신 여부
 static std::atomic<bool> running{true}; // 프로그램 실행 상태 플래그
 
 // 실행 모드 열거형
 // - DRIVE       : 차선 및 객체 검출 후 주행 제어만 수행 (녹화하지 않음)
 // - RECORD      : 카메라 영상을 파일로 녹화만 수행 (주행 제어하지 않음)
 // - DRIVE_RECORD: 주행 제어와 영상 녹화를 동시에 수행
-enum class Mode { DRIVE, RECORD, DRIVE_RECORD };
+// - BENCH       : 녹화 영상으로 인식 단계 처리 시간만 측정 (카메라/제어 미사용)
+// - CAMERA_BENCH: 카메라 백엔드별 캡처 지연/CPU 측정 (인식/제어 미사용)
+enum class Mode { DRIVE, RECORD, DRIVE_RECORD, BENCH, CAMERA_BENCH };
 static Mode current_mode = Mode::DRIVE; // 기본 실행 모드는 DRIVE
 
+// PIPELINE_POLL_MS > 0 이면 예전처럼 단계마다 고정 sleep (지연 비교용, 기본 0: 이벤트 구동)
+static void legacyPollSleep() {
+    if (PIPELINE_POLL_MS > 0) std::this_thread::sleep_for(std::chrono::milliseconds(PIPELINE_POLL_MS));
+}
+
 // SIGINT 시그널(CTRL+C) 처리 함수
 void signal_handler(int) {
     running = false; // 프로그램 종료 플래그 설정
@@ -67,11 +73,28 @@ std::string getTimestampedFilename(const std::string& base_dir) {
     return oss.str(); // 완성된 파일명 반환
 }
 
+// 캡처/전처리 단계에서 변환·분류할 행 범위
+// - "auto"  : 차선/객체 검출기가 읽는 행의 합집합
+// - "manual": ROI_Y_START ~ ROI_Y_END
+// - 그 외   : 전체 행
+cv::Range getCaptureCropRows() {
+    const int height = FRAME_HEIGHT;
+    if (CAPTURE_CROP == "auto") {
+        cv::Range lane = LaneDetector::requiredRows(height);
+        cv::Range object = ObjectDetector::requiredRows(height);
+        return cv::Range(std::min(lane.start, object.start), std::max(lane.end, object.end));
+    }
+    if (CAPTURE_CROP == "manual") {
+        return cv::Range(std::clamp(ROI_Y_START, 0, height), std::clamp(ROI_Y_END, 0, height));
+    }
+    return cv::Range(0, height);
+}
+
 int main(int argc, char** argv) {
     // 상수 파일 로드
     try {
         load_constants("constants.json"); // constants.json -> constants.hpp
-        std::cout << "Steering Gain: " << STEERING_KP << "\n"; // 로드된 상수 출력
+        std::cout << "Steering Gain: " << config().STEERING_KP << "\n"; // 로드된 상수 출력
     } catch (const std::exception& e) {
         std::cerr << "[ERROR] 상수 로드 실패: " << e.what() << std::endl;
         return 1;
@@ -79,9 +102,9 @@ int main(int argc, char** argv) {
 
     signal(SIGINT, signal_handler); // SIGINT 시그널 핸들러 등록
 
-    // 실행 모드 파싱 (d, r, dr)
+    // 실행 모드 파싱 (d, r, dr, b, c)
     if (argc < 2) {
-        std::cerr << "[ERROR] 실행 인자를 지정해주세요: d, r, dr 중 하나\n";
+        std::cerr << "[ERROR] 실행 인자를 지정해주세요: d, r, dr, b, c 중 하나\n";
         return 1;
     }
     std::string mode_arg = argv[1]; // 명령줄 인자
@@ -91,12 +114,26 @@ int main(int argc, char** argv) {
         current_mode = Mode::RECORD;
     } else if (mode_arg == "dr") {
         current_mode = Mode::DRIVE_RECORD;
+    } else if (mode_arg == "b") {
+        current_mode = Mode::BENCH;
+    } else if (mode_arg == "c") {
+        current_mode = Mode::CAMERA_BENCH;
     } else {
-        std::cerr << "[ERROR] 잘못된 모드입니다. d, r, dr 중 하나를 선택해주세요.\n";
+        std::cerr << "[ERROR] 잘못된 모드입니다. d, r, dr, b, c 중 하나를 선택해주세요.\n";
         return 1;
     }
     std::cout << "[INFO] 선택된 모드: " << mode_arg << "\n";
 
+    // 벤치마크 모드: ./auto_drive b [영상 경로]
+    if (current_mode == Mode::BENCH) {
+        return runBenchmark(argc > 2 ? argv[2] : "");
+    }
+
+    // 카메라 벤치마크 모드: ./auto_drive c [백엔드당 측정 시간(초)]
+    if (current_mode == Mode::CAMERA_BENCH) {
+        return runCameraBenchmark(argc > 2 ? std::stod(argv[2]) : 5.0);
+    }
+
     // 카메라 초기화
     USBCam cam;
     if (!cam.init()) {
@@ -104,6 +141,10 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    if (PERCEPTION_INPUT == "bayer" && CAMERA_BACKEND == "gstreamer") {
+        std::cout << "[WARN] gstreamer 백엔드는 BGR 만 제공 → PERCEPTION_INPUT \"bayer\" 무시\n";
+    }
+
     // 비디오 녹화 초기화 (레코드 또는 DRIVE_RECORD 모드)
     VideoRecorder recorder;
     if (current_mode == Mode::RECORD || current_mode == Mode::DRIVE_RECORD) {
@@ -112,148 +153,233 @@ int main(int argc, char** argv) {
             std::cerr << "[ERROR] 비디오 저장 초기화 실패\n";
             return 1;
         }
+        recorder.startThread(); // 인코딩은 녹화 스레드에서 (카메라 스레드 지연 방지)
+    }
+
+    bool drive_enabled = (current_mode == Mode::DRIVE || current_mode == Mode::DRIVE_RECORD);
+
+    // 주행 중 constants.json 수정 시 튜닝 값만 다시 적용 (카메라/파이썬 재초기화 없이)
+    ConfigWatcher config_watcher("constants.json");
+    if (drive_enabled && CONFIG_HOT_RELOAD) config_watcher.start();
+
+    // 주행 모드에서는 검출기가 읽는 행만 변환/분류
+    // 녹화하는 모드(RECORD, DRIVE_RECORD)는 자른 행 밖이 0 으로 지워지므로 전체 프레임 유지
+    cv::Range crop_rows(0, FRAME_HEIGHT);
+    if (current_mode == Mode::DRIVE) {
+        crop_rows = getCaptureCropRows();
+        cam.setCropRows(crop_rows);
     }
+    std::cout << "[INFO] 캡처 ROI 행 (" << CAPTURE_CROP << "): " << crop_rows.start << " ~ " << crop_rows.end
+              << " / " << FRAME_HEIGHT << " (" << 100 * crop_rows.size() / FRAME_HEIGHT << "%)\n";
+
+    // 실행 중 페이지 폴트 방지 (MEMORY_LOCK), 이후 할당은 고정된 페이지 사용
+    lockProcessMemory();
+
+    // 최신 전처리 결과 전달 채널 (최신 1 + 기록 1 + 인식 스레드 1 + 여유 1 슬롯)
+    // 상수 로드 이후에 만들어야 슬롯이 주행 크기로 할당됨
+    FrameChannel frame_channel(4);
+    // 검출 스레드 결과를 프레임 ID 로 맞춰 제어 스레드에 전달 (JOIN_POLICY)
+    ResultJoiner result_joiner;
+    // 제어기 -> 인식 스레드: 현재 주행 상태에서 실행할 검출기와 간격
+    std::atomic<DetectorSchedule> detector_schedule{DetectorSchedule()};
 
     // 카메라 캡처 스레드 (모든 모드에서 실행)
     std::thread camera_thread([&]() {
+        applyThreadProfile("camera");
+        PeriodJitter jitter; // 캡처 주기 측정
+        FramePreprocessor preprocessor;
+        preprocessor.setCropRows(crop_rows);
+        CapturedFrame captured; // 카메라 버퍼 참조 (다음 read() 에서 반환)
+        // Bayer 분류 경로는 전처리를 하는 주행 모드에서만 사용
+        const bool bayer_input = drive_enabled && PERCEPTION_INPUT == "bayer";
         while (running.load()) {
-            cv::Mat frame = cam.getFrame(); // 프레임 읽기
-            if (frame.empty()) continue; // 유효 프레임 아니면 스킵
-
-            // 최신 프레임 공유
-            auto ptr = std::make_shared<cv::Mat>(frame);
-            {
-                std::lock_guard<std::mutex> lock(frame_mutex);
-                shared_frame = ptr;
-                if (!first_frame_ready) {
-                    first_frame_ready = true;
-                    first_frame_cv.notify_all(); // 첫 프레임 수신 알림
+            // 최신 프레임 읽기 (새 프레임이 도착할 때까지 블록), 실패 시 스킵
+            if (!cam.read(captured, bayer_input)) continue;
+            jitter.tick();
+            // 캡처 시각을 주지 않는 백엔드(gstreamer)는 read 반환 시각으로 대체
+            if (captured.timestamp_ns <= 0) captured.timestamp_ns = monotonicNs();
+
+            // 프레임당 한 번만 전처리 후 채널에 게시 (주행 모드에서만 필요)
+            const PreprocessedFrame* published = nullptr;
+            if (drive_enabled) {
+                PreprocessedFrame* slot = frame_channel.beginWrite();
+                if (slot) {
+                    pinConfig(); // 프레임 단위 설정 고정
+                    preprocessor.process(captured, *slot);
+                    frame_channel.publish();
+                    published = slot; // 다음 beginWrite() 전까지는 덮어쓰지 않음
                 }
             }
 
             // RECORD, DRIVE_RECORD 모드에서만 녹화 수행
             if (current_mode == Mode::RECORD || current_mode == Mode::DRIVE_RECORD) {
-                recorder.write(frame); // 녹화
+                // Bayer 입력이면 전처리 단계가 만든 BGR 프레임을 녹화
+                recorder.write(published ? published->frame : captured.image); // 녹화
             }
 
             // VIEWER 모드 화면 출력 및 ESC키 종료
             if (VIEWER) {
-                // cv::imshow("Live", frame);
+                // cv::imshow("Live", captured.image);
                 if (cv::waitKey(1) == 27) {
                     running = false;
                 }
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // CPU 과부하 방지
+            legacyPollSleep();
+        }
+        frame_channel.close(); // 대기 중인 인식 스레드 깨움
+        jitter.report("camera");
+        if (drive_enabled) {
+            std::cout << "[INFO] 게시 프레임: " << frame_channel.published()
+                      << ", 슬롯 부족으로 버린 프레임: " << frame_channel.dropped() << "\n";
         }
     });
 
-    // 첫 번째 프레임 수신 대기
-    {
-        std::unique_lock<std::mutex> lock(frame_mutex);
-        first_frame_cv.wait(lock, [] { return first_frame_ready; });
-    }
-
     // DRIVE, DRIVE_RECORD 모드에서만 실행할 스레드
-    std::thread lane_thread;
-    std::thread object_thread;
+    std::thread perception_thread;
     std::thread control_thread;
-    if (current_mode == Mode::DRIVE || current_mode == Mode::DRIVE_RECORD) {
-        // 차선 검출 스레드
-        lane_thread = std::thread([&]() {
-            LaneDetector lanedetector;
+    if (drive_enabled) {
+        // 인식 스레드: 새 프레임마다 차선/정지선/횡단보도/출발선 검출을 작업 실행기로 병렬 실행
+        perception_thread = std::thread([&]() {
+            applyThreadProfile("perception");
+            PeriodJitter jitter;
+            TaskExecutor executor(EXECUTOR_WORKERS, "worker"); // 이 스레드도 wait() 중 작업 실행
+            PerceptionGraph graph(executor);
+            LaneResult lane_result;
+            ObjectResult object_result;
+            cv::Mat lane_vis, object_vis; // 시각화 버퍼 (프레임마다 재사용)
+            FrameChannel::Ref frame; // 처리 중인 슬롯 참조
+            uint64_t last_id = 0;    // 마지막으로 처리한 프레임 ID
             while (running.load()) {
-                std::shared_ptr<cv::Mat> frame;
-                {
-                    std::lock_guard<std::mutex> lock(frame_mutex);
-                    frame = shared_frame;
-                }
-                if (frame && !frame->empty()) {
-                    cv::Mat vis_out;
-                    int offset = lanedetector.process(*frame, vis_out); // 차선 오프셋 계산
-                    yellow_pixel_count = lanedetector.getYellowPixelCount();
-                    {
-                        std::lock_guard<std::mutex> lock(lane_mutex);
-                        mean_center_offset = offset; // 전역 오프셋 갱신
-                    }
-                    {
-                        std::lock_guard<std::mutex> lock(control_mutex);
-                        control_ready = true;
-                        control_cv.notify_one(); // 제어 스레드 실행 알림
-                    }
+                // 새 프레임이 게시될 때까지 대기 (같은 프레임 중복 처리 없음)
+                if (!frame_channel.waitNext(last_id, frame, FRAME_WAIT_TIMEOUT)) continue;
+                last_id = frame.id();
+                jitter.tick();
+                if (!frame->frame.empty()) {
+                    graph.run(*frame, frame.id(), lane_result, object_result, PerceptionGraph::Layout::GRAPH,
+                              detector_schedule.load(std::memory_order_relaxed));
+                    // 제어 스레드로 전달
+                    result_joiner.pushLane(lane_result);
+                    result_joiner.pushObject(object_result);
                     if (VIEWER) {
-                        cv::imshow("Lane", vis_out);
+                        cv::imshow("Grayscale Lane", frame->grayscale);
+                        graph.laneOverlay().render(lane_vis);
+                        cv::imshow("Lane", lane_vis);
+                        graph.objectOverlay().render(object_vis);
+                        cv::imshow("Objects", object_vis);
                         if (cv::waitKey(1) == 27) running = false;
                     }
                 }
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                frame.reset(); // 다음 대기 전에 슬롯 반환
+                legacyPollSleep();
             }
+            jitter.report("perception");
         });
 
-        // 객체 검출 스레드
-        object_thread = std::thread([&]() {
-            ObjectDetector detector;
-            while (running.load()) {
-                std::shared_ptr<cv::Mat> frame;
-                {
-                    std::lock_guard<std::mutex> lock(frame_mutex);
-                    frame = shared_frame;
+        // 조향 제어 스레드
+        // - CONTROL_RATE_HZ > 0: timerfd 고정 주기로 최신 인식 결과를 읽고 차선 오프셋은 결과 나이만큼 외삽
+        // - CONTROL_RATE_HZ == 0: 합류된 인식 결과가 올 때마다 제어 (이벤트 구동)
+        control_thread = std::thread([&]() {
+            applyThreadProfile("control");
+            PeriodJitter jitter;
+            Controller controller;
+            LatencyStats latency; // 캡처 -> 제어 출력 지연
+            PerceptionSnapshot snapshot;
+            DetectorSchedule schedule;
+
+            // 주행 상태가 바뀌면 다음 프레임부터 관심 검출기만 매 프레임 실행
+            auto updateSchedule = [&]() {
+                DetectorSchedule next_schedule = controller.detectorSchedule();
+                if (next_schedule != schedule) {
+                    schedule = next_schedule;
+                    detector_schedule.store(schedule, std::memory_order_relaxed);
+                    std::cout << "[INFO] 검출기 실행 간격 (0: 건너뜀) 정지선 " << int(schedule.stop_line)
+                              << " | 횡단보도 " << int(schedule.crosswalk)
+                              << " | 출발선 " << int(schedule.start_line)
+                              << " | 차선 " << (schedule.white_line_drive ? "흰색" : "노란색")
+                              << (schedule.roi_remove_left ? " (좌측 제거)" : "") << "\n";
                 }
-                if (frame && !frame->empty()) {
-                    cv::Mat vis_out;
-                    std::vector<bool> flags;
-                    detector.process(*frame, vis_out, flags); // 객체 검출
-                    {
-                        std::lock_guard<std::mutex> lock(object_mutex);
-                        detections_flags = flags; // 검출 결과 저장
-                    }
-                    {
-                        std::lock_guard<std::mutex> lock(control_mutex);
-                        control_ready = true;
-                        control_cv.notify_one(); // 제어 스레드 실행 알림
+            };
+
+            if (CONTROL_RATE_HZ > 0) {
+                PeriodicTimer timer(1000000000LL / CONTROL_RATE_HZ);
+                OffsetExtrapolator extrapolator(static_cast<int64_t>(CONTROL_EXTRAPOLATE_MAX_MS) * 1000000);
+                LatencyStats tick_work;  // 주기당 처리 시간
+                LatencyStats result_age; // 제어 시점의 인식 결과 나이
+                uint64_t ticks = 0, missed = 0, overruns = 0;
+                PerceptionSnapshot command;
+                if (!timer.start()) running = false;
+                while (running.load()) {
+                    const uint64_t expirations = timer.wait();
+                    if (expirations == 0) break;
+                    const int64_t tick_ns = monotonicNs();
+                    jitter.tick();
+                    pinConfig(); // 주기 단위 설정 고정
+                    ++ticks;
+                    missed += expirations - 1;
+
+                    // 이번 주기까지 합류된 결과 중 가장 최신 것 (기다리지 않음)
+                    // - 객체 검출 플래그는 이번 주기에 꺼낸 모든 결과를 OR (중간 결과의 정지선 등을 놓치지 않음)
+                    bool fresh = false;
+                    ObjectResult tick_object;
+                    while (result_joiner.next(snapshot, std::chrono::milliseconds(0))) {
+                        fresh = true;
+                        tick_object.stop_line |= snapshot.object.stop_line;
+                        tick_object.crosswalk |= snapshot.object.crosswalk;
+                        tick_object.start_line |= snapshot.object.start_line;
                     }
-                    if (VIEWER) {
-                        cv::imshow("Objects", vis_out);
-                        if (cv::waitKey(1) == 27) running = false;
+                    if (fresh) extrapolator.push(snapshot.lane);
+                    if (snapshot.frame_id == 0) continue; // 아직 인식 결과 없음
+
+                    // 객체 검출은 새 결과가 온 주기에만 전달 (같은 검출을 여러 번 처리하지 않음)
+                    command.lane = snapshot.lane;
+                    command.lane.offset = extrapolator.predict(tick_ns, command.lane.offset_ns);
+                    if (fresh) {
+                        tick_object.frame_id = snapshot.object.frame_id;
+                        tick_object.capture_ns = snapshot.object.capture_ns;
                     }
-                }
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            }
-        });
+                    command.object = tick_object;
+                    command.frame_id = snapshot.frame_id;
+                    command.capture_ns = snapshot.capture_ns;
+                    command.coherent = snapshot.coherent;
+                    controller.update(command);
+                    updateSchedule();
 
-        // 조향 제어 스레드
-        control_thread = std::thread([&]() {
-            Controller controller;
-            while (running.load()) {
-                std::unique_lock<std::mutex> lock(control_mutex);
-                control_cv.wait(lock, [] { return control_ready; }); // 알림 대기
-                control_ready = false;
-                lock.unlock();
-
-                // 최근 검출 결과 가져오기
-                bool stop = false, cross = false, start = false;
-                int offset = 0;
-                {
-                    std::lock_guard<std::mutex> lock(lane_mutex);
-                    offset = mean_center_offset;
+                    if (fresh) latency.addSince(snapshot.capture_ns);
+                    result_age.addSince(snapshot.lane.capture_ns);
+                    const int64_t work_ns = monotonicNs() - tick_ns;
+                    tick_work.add(work_ns / 1e6);
+                    if (work_ns > timer.periodNs()) ++overruns;
                 }
-                {
-                    std::lock_guard<std::mutex> lock(object_mutex);
-                    if (detections_flags.size() > 0) stop = detections_flags[0];
-                    if (detections_flags.size() > 1) cross = detections_flags[1];
-                    if (detections_flags.size() > 2) start = detections_flags[2];
+                std::cout << "[INFO] 제어 주기 " << CONTROL_RATE_HZ << " Hz: " << ticks << " 회, 놓친 주기 " << missed
+                          << ", 주기 초과 처리 " << overruns << std::endl;
+                tick_work.report("제어 주기 처리 시간");
+                result_age.report("제어 시점 차선 결과 나이");
+            } else {
+                while (running.load()) {
+                    // 같은 프레임 기준 검출 결과 묶음이 준비될 때까지 대기 (시간 초과는 종료 확인용)
+                    if (!result_joiner.next(snapshot, FRAME_WAIT_TIMEOUT)) continue;
+                    jitter.tick();
+                    pinConfig();
+                    controller.update(snapshot);
+                    updateSchedule();
+                    latency.addSince(snapshot.capture_ns);
+                    legacyPollSleep();
                 }
-                int yellow_count = yellow_pixel_count.load();
-		            controller.update(stop, cross, start, offset, yellow_count);
-                std::this_thread::sleep_for(std::chrono::milliseconds(10)); // 제어 주기 조절
             }
+            latency.report(PIPELINE_POLL_MS > 0
+                ? "캡처 -> 제어 지연 (단계별 " + std::to_string(PIPELINE_POLL_MS) + " ms sleep)"
+                : CONTROL_RATE_HZ > 0 ? "캡처 -> 제어 지연 (" + std::to_string(CONTROL_RATE_HZ) + " Hz 고정 주기)"
+                                      : std::string("캡처 -> 제어 지연 (이벤트 구동)"));
+            result_joiner.report();
+            jitter.report("control");
         });
     }
 
     // 스레드 종료 대기
     camera_thread.join();
-    if (lane_thread.joinable()) lane_thread.join();
-    if (object_thread.joinable()) object_thread.join();
+    if (perception_thread.joinable()) perception_thread.join();
+    result_joiner.close(); // 제어 스레드 대기 해제
     if (control_thread.joinable()) control_thread.join();
 
     // 비디오 녹화 자원 해제
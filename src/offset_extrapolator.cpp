@@ -0,0 +1,21 @@
+#include "offset_extrapolator.hpp"
+#include <algorithm>
+#include <cmath>
+
+OffsetExtrapolator::OffsetExtrapolator(int64_t max_ns) : max_ns_(max_ns) {}
+
+void OffsetExtrapolator::push(const LaneResult& lane) {
+    if (lane.frame_id == 0 || lane.frame_id == last_.frame_id) return;
+    const int64_t dt = lane.capture_ns - last_.capture_ns;
+    // 직전 결과가 없거나 시간이 거꾸로면 변화율 초기화
+    rate_ = (last_.frame_id != 0 && dt > 0) ? static_cast<double>(lane.offset - last_.offset) / dt : 0.0;
+    last_ = lane;
+}
+
+int OffsetExtrapolator::predict(int64_t now_ns, int64_t& at_ns) const {
+    at_ns = last_.capture_ns;
+    if (last_.frame_id == 0) return 0;
+    const int64_t age = std::clamp<int64_t>(now_ns - last_.capture_ns, 0, max_ns_);
+    at_ns = last_.capture_ns + age;
+    return static_cast<int>(std::lround(last_.offset + rate_ * age));
+}
@@ -0,0 +1,88 @@
+#include "pca9685_actuator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace {
+// PCA9685 레지스터
+constexpr uint8_t MODE1 = 0x00;
+constexpr uint8_t LED0_ON_L = 0x06;
+constexpr uint8_t PRESCALE = 0xFE;
+
+constexpr uint8_t MODE1_SLEEP = 0x10;
+constexpr uint8_t MODE1_AUTO_INCREMENT = 0x20;
+constexpr uint8_t MODE1_RESTART = 0x80;
+
+constexpr double OSCILLATOR_HZ = 25000000.0;
+constexpr double PWM_HZ = 50.0;
+constexpr double PWM_PERIOD_S = 1.0 / PWM_HZ;
+
+constexpr int STEERING_CHANNEL = 0;
+constexpr int THROTTLE_CHANNEL = 1;
+
+// 채널 하나의 ON_L, ON_H, OFF_L, OFF_H (ON 카운트 0 에서 켜고 count 에서 끔)
+void encodeChannel(uint16_t count, uint8_t* out) {
+    if (count == 0x1000) {
+        // 항상 켜짐: LEDn_ON_H 의 bit 4
+        out[0] = 0x00; out[1] = 0x10; out[2] = 0x00; out[3] = 0x00;
+    } else {
+        out[0] = 0x00; out[1] = 0x00;
+        out[2] = static_cast<uint8_t>(count & 0xFF);
+        out[3] = static_cast<uint8_t>(count >> 8);
+    }
+}
+}
+
+Pca9685Actuator::Pca9685Actuator(std::unique_ptr<I2cBus> bus) : bus_(std::move(bus)) {}
+
+bool Pca9685Actuator::writeRegister(uint8_t reg, uint8_t value) {
+    const uint8_t data[2] = {reg, value};
+    return bus_->write(data, sizeof(data));
+}
+
+// 초기화 순서는 Adafruit PCA9685 드라이버와 같음: 리셋 -> 슬립 중 분주비 설정 -> 재시작 + 자동 증가
+bool Pca9685Actuator::open() {
+    if (!bus_ || !bus_->open()) return false;
+
+    const uint8_t prescale = static_cast<uint8_t>(OSCILLATOR_HZ / 4096.0 / PWM_HZ + 0.5);
+    bool ok = writeRegister(MODE1, 0x00);
+    ok = ok && writeRegister(MODE1, MODE1_SLEEP);
+    ok = ok && writeRegister(PRESCALE, prescale);
+    ok = ok && writeRegister(MODE1, 0x00);
+    // 발진기 안정화 대기 (데이터시트 500us 이상)
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ok = ok && writeRegister(MODE1, MODE1_RESTART | MODE1_AUTO_INCREMENT);
+    if (!ok) {
+        std::cerr << "[ERROR] PCA9685 초기화 실패 (" << bus_->name() << ")" << std::endl;
+        return false;
+    }
+    std::cout << "[INFO] PCA9685 초기화 완료 (" << bus_->name() << ", prescale " << static_cast<int>(prescale) << ")" << std::endl;
+    return true;
+}
+
+// piracer 의 duty_cycle 계산과 같은 반올림 (16비트 듀티 -> 12비트 카운트)
+uint16_t Pca9685Actuator::pulseCount(float value) {
+    const double pulse_s = 0.0015 + std::clamp(value, -1.0f, 1.0f) * 0.0005;
+    const int duty = static_cast<int>(0xFFFF * (pulse_s / PWM_PERIOD_S));
+    if (duty >= 0xFFFF) return 0x1000;
+    return static_cast<uint16_t>((duty + 1) >> 4);
+}
+
+bool Pca9685Actuator::set(float steering, float throttle) {
+    const uint16_t steering_count = pulseCount(-steering);
+    const uint16_t throttle_count = pulseCount(throttle);
+    if (steering_count == last_steering_ && throttle_count == last_throttle_) return true;
+
+    // LED0 ~ LED1 레지스터 8바이트를 한 번에 기록
+    static_assert(THROTTLE_CHANNEL == STEERING_CHANNEL + 1, "채널이 연속이어야 한 트랜잭션으로 기록 가능");
+    uint8_t data[1 + 8];
+    data[0] = static_cast<uint8_t>(LED0_ON_L + 4 * STEERING_CHANNEL);
+    encodeChannel(steering_count, data + 1);
+    encodeChannel(throttle_count, data + 5);
+    if (!bus_->write(data, sizeof(data))) return false;
+
+    last_steering_ = steering_count;
+    last_throttle_ = throttle_count;
+    return true;
+}
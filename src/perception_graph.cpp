@@ -0,0 +1,101 @@
+#include "perception_graph.hpp"
+
+PerceptionGraph::PerceptionGraph(TaskExecutor& executor) : executor_(executor) {}
+
+namespace {
+// 실행 간격 every (0: 건너뜀) 기준으로 이번 프레임에 실행할지
+bool scheduled(uint8_t every, uint64_t frame_id) {
+    return every != 0 && frame_id % every == 0;
+}
+}
+
+void PerceptionGraph::run(const PreprocessedFrame& frame, uint64_t frame_id, LaneResult& lane, ObjectResult& object,
+                          Layout layout, DetectorSchedule schedule) {
+    frame_ = &frame;
+    // 프레임 하나는 같은 설정으로 처리 (작업 스레드도 ConfigScope 로 같은 Config 사용)
+    config_ = currentConfig();
+    if (!config_) config_ = std::make_shared<const Config>();
+    lane_detector_.setDriveMode(schedule.roi_remove_left, schedule.white_line_drive);
+    run_lane_ = scheduled(schedule.lane, frame_id);
+    run_stop_ = scheduled(schedule.stop_line, frame_id);
+    run_crosswalk_ = scheduled(schedule.crosswalk, frame_id);
+    run_start_ = scheduled(schedule.start_line, frame_id);
+    stop_line_ = crosswalk_ = start_line_ = false;
+    object_overlay_.reset(frame.frame);
+    crosswalk_overlay_.reset(frame.frame);
+    start_overlay_.reset(frame.frame);
+
+    if (layout == Layout::SERIAL) {
+        runLane(this);
+        runObjects(this);
+    } else {
+        TaskGroup group;
+        if (run_lane_) executor_.submit(group, &PerceptionGraph::runLane, this);
+        if (layout == Layout::SPLIT) {
+            if (run_stop_ || run_crosswalk_ || run_start_) executor_.submit(group, &PerceptionGraph::runObjects, this);
+        } else {
+            if (run_stop_) executor_.submit(group, &PerceptionGraph::runStopLine, this);
+            if (run_crosswalk_) executor_.submit(group, &PerceptionGraph::runCrosswalk, this);
+            if (run_start_) executor_.submit(group, &PerceptionGraph::runStartLine, this);
+        }
+        executor_.wait(group);
+    }
+
+    // 합류: 객체 오버레이는 정지선 -> 횡단보도 -> 출발선 순서 (기존 process() 와 같은 순서)
+    object_overlay_.append(crosswalk_overlay_);
+    object_overlay_.append(start_overlay_);
+
+    lane.frame_id = frame_id;
+    lane.capture_ns = frame.capture_ns;
+    lane.offset = lane_offset_;
+    lane.offset_ns = lane_offset_ns_;
+    lane.frame_offset = lane_offset_;
+    lane.frame_offset_ns = lane_offset_ns_;
+    lane.heading = lane_estimate_.heading;
+    lane.curvature = lane_estimate_.curvature;
+    lane.yellow_pixel_count = lane_detector_.getYellowPixelCount();
+
+    object.frame_id = frame_id;
+    object.capture_ns = frame.capture_ns;
+    object.stop_line = stop_line_;
+    object.crosswalk = crosswalk_;
+    object.start_line = start_line_;
+    frame_ = nullptr;
+}
+
+// 차선을 건너뛴 프레임은 직전 오프셋 유지 (조향은 매 주기 값이 필요)
+void PerceptionGraph::runLane(void* self) {
+    auto& graph = *static_cast<PerceptionGraph*>(self);
+    ConfigScope scope(*graph.config_);
+    if (!graph.run_lane_) return;
+    graph.lane_offset_ = graph.lane_detector_.process(*graph.frame_, graph.lane_overlay_);
+    graph.lane_estimate_ = graph.lane_detector_.getLaneEstimate();
+    graph.lane_offset_ns_ = graph.frame_->capture_ns;
+}
+
+void PerceptionGraph::runStopLine(void* self) {
+    auto& graph = *static_cast<PerceptionGraph*>(self);
+    ConfigScope scope(*graph.config_);
+    if (!graph.run_stop_) return;
+    graph.stop_line_ = graph.object_detector_.detectStopLine(*graph.frame_, graph.object_overlay_);
+}
+
+void PerceptionGraph::runCrosswalk(void* self) {
+    auto& graph = *static_cast<PerceptionGraph*>(self);
+    ConfigScope scope(*graph.config_);
+    if (!graph.run_crosswalk_) return;
+    graph.crosswalk_ = graph.object_detector_.detectCrosswalk(*graph.frame_, graph.crosswalk_overlay_);
+}
+
+void PerceptionGraph::runStartLine(void* self) {
+    auto& graph = *static_cast<PerceptionGraph*>(self);
+    ConfigScope scope(*graph.config_);
+    if (!graph.run_start_) return;
+    graph.start_line_ = graph.object_detector_.detectStartLine(*graph.frame_, graph.start_overlay_);
+}
+
+void PerceptionGraph::runObjects(void* self) {
+    runStopLine(self);
+    runCrosswalk(self);
+    runStartLine(self);
+}
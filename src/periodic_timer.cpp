@@ -0,0 +1,39 @@
+#include "periodic_timer.hpp"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+PeriodicTimer::PeriodicTimer(int64_t period_ns) : period_ns_(period_ns) {}
+
+PeriodicTimer::~PeriodicTimer() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+bool PeriodicTimer::start() {
+    fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (fd_ < 0) {
+        std::cerr << "[ERROR] timerfd 생성 실패: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    itimerspec spec{};
+    spec.it_interval.tv_sec = period_ns_ / 1000000000;
+    spec.it_interval.tv_nsec = period_ns_ % 1000000000;
+    spec.it_value = spec.it_interval;
+    if (timerfd_settime(fd_, 0, &spec, nullptr) < 0) {
+        std::cerr << "[ERROR] timerfd 설정 실패: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+uint64_t PeriodicTimer::wait() {
+    uint64_t expirations = 0;
+    while (true) {
+        ssize_t n = ::read(fd_, &expirations, sizeof(expirations));
+        if (n == sizeof(expirations)) return expirations;
+        if (n < 0 && errno == EINTR) continue;
+        return 0;
+    }
+}
@@ -0,0 +1,141 @@
+#include "result_joiner.hpp"
+#include "constants.hpp"
+#include "latency_stats.hpp"
+#include <algorithm>
+#include <iostream>
+
+ResultJoiner::ResultJoiner() {
+    if (JOIN_POLICY != "wait" && JOIN_POLICY != "freshest") {
+        std::cerr << "[WARN] 알 수 없는 JOIN_POLICY: " << JOIN_POLICY << " → wait 사용" << std::endl;
+    }
+    wait_policy_ = (JOIN_POLICY != "freshest");
+    join_timeout_ns_ = static_cast<int64_t>(JOIN_TIMEOUT_MS) * 1000000LL;
+}
+
+void ResultJoiner::pushLane(const LaneResult& result) {
+    if (!lane_queue_.push(result)) queue_full_.fetch_add(1, std::memory_order_relaxed);
+    wake();
+}
+
+void ResultJoiner::pushObject(const ObjectResult& result) {
+    if (!object_queue_.push(result)) queue_full_.fetch_add(1, std::memory_order_relaxed);
+    wake();
+}
+
+void ResultJoiner::wake() {
+    // 큐 기록과 대기자 확인 순서 보장 (next() 쪽 펜스와 짝)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        wait_cv_.notify_one();
+    }
+}
+
+void ResultJoiner::close() {
+    closed_.store(true);
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    wait_cv_.notify_all();
+}
+
+bool ResultJoiner::next(PerceptionSnapshot& out, std::chrono::milliseconds timeout) {
+    const int64_t deadline = monotonicNs() + std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+    while (true) {
+        const int64_t now = monotonicNs();
+        drain();
+        if (tryJoin(out, now)) return true;
+        if (closed_.load() || now >= deadline) return false;
+
+        // 새 결과, 짝 맞추기 시간 초과, 호출자 시간 초과 중 먼저 오는 것까지 대기
+        int64_t wake_at = deadline;
+        if (wait_policy_ && pending_since_ns_ > 0) wake_at = std::min(wake_at, pending_since_ns_ + join_timeout_ns_);
+        waiters_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(wait_mutex_);
+            wait_cv_.wait_for(lock, std::chrono::nanoseconds(std::max<int64_t>(wake_at - now, 0)), [&] {
+                return closed_.load() || !lane_queue_.empty() || !object_queue_.empty();
+            });
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void ResultJoiner::drain() {
+    LaneResult lane;
+    while (lane_queue_.pop(lane)) {
+        lane_history_[lane_next_] = lane;
+        lane_next_ = (lane_next_ + 1) % HISTORY;
+        if (lane.frame_id > lane_latest_.frame_id) lane_latest_ = lane;
+    }
+    ObjectResult object;
+    while (object_queue_.pop(object)) {
+        object_history_[object_next_] = object;
+        object_next_ = (object_next_ + 1) % HISTORY;
+        if (object.frame_id > object_latest_.frame_id) object_latest_ = object;
+    }
+}
+
+bool ResultJoiner::tryJoin(PerceptionSnapshot& out, int64_t now_ns) {
+    if (!wait_policy_) {
+        // freshest: 어느 쪽이든 새 결과가 있으면 최신끼리 합침
+        if (lane_latest_.frame_id > emitted_lane_id_ || object_latest_.frame_id > emitted_object_id_) {
+            emit(out, lane_latest_, object_latest_, lane_latest_.frame_id == object_latest_.frame_id);
+            return true;
+        }
+        return false;
+    }
+
+    // wait: 아직 넘기지 않은 프레임 중 두 검출기 결과가 모두 있는 가장 최근 프레임
+    const LaneResult* lane_match = nullptr;
+    const ObjectResult* object_match = nullptr;
+    for (const auto& lane : lane_history_) {
+        if (lane.frame_id <= emitted_id_ || (lane_match && lane.frame_id <= lane_match->frame_id)) continue;
+        for (const auto& object : object_history_) {
+            if (object.frame_id == lane.frame_id) {
+                lane_match = &lane;
+                object_match = &object;
+                break;
+            }
+        }
+    }
+    if (lane_match) {
+        emit(out, *lane_match, *object_match, true);
+        return true;
+    }
+
+    const bool pending = lane_latest_.frame_id > emitted_id_ || object_latest_.frame_id > emitted_id_;
+    if (!pending) {
+        pending_since_ns_ = 0;
+        return false;
+    }
+    if (pending_since_ns_ == 0) pending_since_ns_ = now_ns;
+    if (now_ns - pending_since_ns_ < join_timeout_ns_) return false;
+
+    // 느린 검출기를 JOIN_TIMEOUT_MS 동안 기다렸으면 최신 결과끼리 넘김
+    emit(out, lane_latest_, object_latest_, false);
+    return true;
+}
+
+void ResultJoiner::emit(PerceptionSnapshot& out, const LaneResult& lane, const ObjectResult& object, bool coherent) {
+    out.lane = lane;
+    out.object = object;
+    out.coherent = coherent;
+    if (lane.frame_id >= object.frame_id) {
+        out.frame_id = lane.frame_id;
+        out.capture_ns = lane.capture_ns;
+    } else {
+        out.frame_id = object.frame_id;
+        out.capture_ns = object.capture_ns;
+    }
+    emitted_id_ = std::max(emitted_id_, out.frame_id);
+    emitted_lane_id_ = lane.frame_id;
+    emitted_object_id_ = object.frame_id;
+    pending_since_ns_ = 0;
+    if (coherent) ++joined_; else ++partial_;
+}
+
+void ResultJoiner::report() const {
+    std::cout << "[INFO] 결과 합류 (" << (wait_policy_ ? "wait" : "freshest") << "): 같은 프레임 " << joined_
+              << " | 최신 결과 조합 " << partial_
+              << " | 큐 가득 참 " << queue_full_.load(std::memory_order_relaxed) << "\n";
+}
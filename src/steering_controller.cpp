@@ -0,0 +1,67 @@
+#include "steering_controller.hpp"
+#include "config.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr float STEERING_LIMIT = 0.7f;
+constexpr int64_t MIN_RATE_INTERVAL_NS = 1000000; // 1 ms 미만 간격은 변화율 계산에서 제외
+}
+
+void SteeringController::reset() {
+    last_ns_ = 0;
+    rate_ = 0.0f;
+    integral_ = 0.0f;
+    last_update_ns_ = 0;
+}
+
+float SteeringController::steering(const LaneResult& lane, int64_t now_ns, float trim) {
+    const Config& cfg = config();
+    const float offset = static_cast<float>(lane.offset);
+
+    // 프레임 시각 기준 오프셋 변화율 (외삽값이 아닌 측정 오프셋 사용)
+    if (lane.frame_offset_ns > 0 && lane.frame_offset_ns != last_ns_) {
+        const float measured = static_cast<float>(lane.frame_offset);
+        const int64_t dt = lane.frame_offset_ns - last_ns_;
+        if (last_ns_ > 0 && dt >= MIN_RATE_INTERVAL_NS) {
+            const float rate = (measured - last_offset_) / (dt * 1e-9f);
+            rate_ += cfg.STEERING_D_FILTER * (rate - rate_);
+        }
+        if (last_ns_ == 0 || dt >= MIN_RATE_INTERVAL_NS) {
+            last_ns_ = lane.frame_offset_ns;
+            last_offset_ = measured;
+        }
+    }
+
+    // 지연 보상: 출력이 실제로 반영될 시각의 오프셋 예측
+    float error = offset;
+    if (cfg.STEERING_LATENCY_COMP && lane.offset_ns > 0) {
+        const int64_t horizon_ns = std::clamp<int64_t>(
+            now_ns + static_cast<int64_t>(cfg.STEERING_ACTUATION_DELAY_MS) * 1000000 - lane.offset_ns,
+            0, static_cast<int64_t>(cfg.STEERING_LATENCY_MAX_MS) * 1000000);
+        error += rate_ * (horizon_ns * 1e-9f);
+    }
+
+    // 적분 (제어 호출 간격 기준, 포화 방지)
+    if (cfg.STEERING_KI != 0.0f && last_update_ns_ > 0) {
+        const float dt_s = (now_ns - last_update_ns_) * 1e-9f;
+        const float limit = cfg.STEERING_I_LIMIT / cfg.STEERING_KI;
+        integral_ = std::clamp(integral_ + error * dt_s, -std::fabs(limit), std::fabs(limit));
+    }
+    last_update_ns_ = now_ns;
+
+    const float feedback = cfg.STEERING_KP * error + cfg.STEERING_KI * integral_ + cfg.STEERING_KD * rate_;
+    const float feedforward = cfg.STEERING_KFF_HEADING * lane.heading + cfg.STEERING_KFF_CURVATURE * lane.curvature;
+    return std::clamp(trim + feedback + feedforward, -STEERING_LIMIT, STEERING_LIMIT);
+}
+
+// 굽은 정도(0 ~ 1)에 따라 MAX_THROTTLE(직선) ~ BASE_THROTTLE(곡선) 사이 보간
+float SteeringController::throttle(const LaneResult& lane) const {
+    const Config& cfg = config();
+    if (!cfg.THROTTLE_SCHEDULING) return cfg.BASE_THROTTLE;
+    const float bend = cfg.THROTTLE_HEADING_GAIN * std::fabs(lane.heading) +
+                       cfg.THROTTLE_CURVATURE_GAIN * std::fabs(lane.curvature) +
+                       cfg.THROTTLE_KP * std::fabs(static_cast<float>(lane.offset));
+    const float straight = 1.0f - std::clamp(bend, 0.0f, 1.0f);
+    return std::min(cfg.BASE_THROTTLE + (cfg.MAX_THROTTLE - cfg.BASE_THROTTLE) * straight, cfg.MAX_THROTTLE);
+}
@@ -0,0 +1,116 @@
+#include "task_executor.hpp"
+#include "thread_profile.hpp"
+#include <algorithm>
+
+TaskExecutor::TaskExecutor(int workers, const std::string& name) {
+    workers = std::max(workers, 1);
+    for (int i = 0; i < workers; ++i) queues_.push_back(std::make_unique<Queue>());
+    for (int i = 0; i < workers; ++i) threads_.emplace_back(&TaskExecutor::workerLoop, this, i, name + std::to_string(i));
+}
+
+TaskExecutor::~TaskExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_cv_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+void TaskExecutor::submit(TaskGroup& group, Fn fn, void* ctx) {
+    group.pending_.fetch_add(1, std::memory_order_relaxed);
+    Task task{fn, ctx, &group};
+    const int queue = static_cast<int>(next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size());
+    if (!push(queue, task)) {
+        run(task);
+        return;
+    }
+
+    // 잠든 작업자가 있으면 깨움
+    epoch_.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        sleep_cv_.notify_one();
+    }
+}
+
+void TaskExecutor::wait(TaskGroup& group) {
+    Task task;
+    while (group.pending_.load(std::memory_order_acquire) > 0) {
+        if (findTask(0, task)) {
+            run(task);
+            continue;
+        }
+        // 남은 작업이 모두 다른 스레드에서 실행 중이면 완료 알림 대기
+        std::unique_lock<std::mutex> lock(group.mutex_);
+        group.done_cv_.wait(lock, [&] { return group.pending_.load(std::memory_order_acquire) == 0; });
+    }
+    // 마지막 작업을 끝낸 스레드가 그룹 잠금을 놓을 때까지 대기
+    std::lock_guard<std::mutex> lock(group.mutex_);
+}
+
+bool TaskExecutor::push(int queue, const Task& task) {
+    Queue& q = *queues_[queue];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.size == Queue::CAPACITY) return false;
+    q.tasks[(q.head + q.size) % Queue::CAPACITY] = task;
+    ++q.size;
+    return true;
+}
+
+bool TaskExecutor::popBack(int queue, Task& task) {
+    Queue& q = *queues_[queue];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.size == 0) return false;
+    --q.size;
+    task = q.tasks[(q.head + q.size) % Queue::CAPACITY];
+    return true;
+}
+
+bool TaskExecutor::stealFront(int queue, Task& task) {
+    Queue& q = *queues_[queue];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.size == 0) return false;
+    task = q.tasks[q.head];
+    q.head = (q.head + 1) % Queue::CAPACITY;
+    --q.size;
+    return true;
+}
+
+bool TaskExecutor::findTask(int start, Task& task) {
+    const int count = static_cast<int>(queues_.size());
+    for (int n = 0; n < count; ++n) {
+        if (stealFront((start + n) % count, task)) return true;
+    }
+    return false;
+}
+
+void TaskExecutor::run(const Task& task) {
+    task.fn(task.ctx);
+    // 그룹은 wait() 가 반환되면 사라질 수 있으므로 감소와 알림을 잠금 안에서 끝냄
+    TaskGroup& group = *task.group;
+    std::lock_guard<std::mutex> lock(group.mutex_);
+    if (group.pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) group.done_cv_.notify_all();
+}
+
+void TaskExecutor::workerLoop(int index, std::string name) {
+    applyThreadProfile(name.c_str());
+    Task task;
+    while (!stop_.load(std::memory_order_relaxed)) {
+        const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+        if (popBack(index, task) || findTask(index + 1, task)) {
+            run(task);
+            continue;
+        }
+
+        // 큐를 살핀 뒤 새 작업이 추가되지 않았을 때만 잠듦
+        sleepers_.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [&] {
+                return stop_.load(std::memory_order_relaxed) || epoch_.load(std::memory_order_seq_cst) != epoch;
+            });
+        }
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
@@ -1,38 +1,145 @@
 // usb_cam.cpp (리팩터링: 클래스 기반, main 제거)
 #include "usb_cam.hpp"
 #include "constants.hpp"
+#include "v4l2_capture.hpp"
+#include "file_capture.hpp"
 
 #include <iostream>
-#include <cstring>
-#include <fcntl.h>
-#include <sys/mman.h>
-#include <unistd.h>
+#include <algorithm>
+
+namespace {
+
+// 기존 GStreamer 파이프라인 백엔드 (bayer2rgb + videoscale 을 GStreamer 가 처리)
+class GstreamerCapture : public FrameSource {
+public:
+    bool open() override {
+        std::string pipeline =
+            "v4l2src device=" + CAMERA_DEVICE + " ! "
+            "bayer2rgb ! "
+            "videoconvert ! "
+            "videoscale ! video/x-raw,width=" + std::to_string(CAMERA_CAPTURE_WIDTH) +
+            ",height=" + std::to_string(CAMERA_CAPTURE_HEIGHT) + " ! "
+            "appsink";
+
+        cap.open(pipeline, cv::CAP_GSTREAMER);
+        if (!cap.isOpened()) {
+            std::cerr << "[ERROR] GStreamer 파이프라인으로 카메라 열기 실패" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool read(CapturedFrame& out) override {
+        cv::Mat frame;
+        cap >> frame;
+        if (frame.empty()) {
+            std::cerr << "[WARN] 프레임 읽기 실패" << std::endl;
+            return false;
+        }
+        out.image = frame;
+        out.fourcc = 0;
+        out.timestamp_ns = 0; // appsink 는 커널 캡처 시각을 주지 않음
+        out.sequence = 0;
+        out.hold.reset();
+        return true;
+    }
+
+    const char* name() const override { return "gstreamer"; }
+
+private:
+    cv::VideoCapture cap;    // OpenCV GStreamer 캡처 객체
+};
+
+} // namespace
+
+USBCam::USBCam() {}
+
+USBCam::~USBCam() {}
 
 bool USBCam::init() {
-    std::string pipeline =
-        "v4l2src device=/dev/video0 ! "
-        "bayer2rgb ! "
-        "videoconvert ! "
-        "videoscale ! video/x-raw,width=640,height=240 ! "
-        "appsink";
-
-    cap.open(pipeline, cv::CAP_GSTREAMER);
-    if (!cap.isOpened()) {
-        std::cerr << "[ERROR] GStreamer 파이프라인으로 카메라 열기 실패" << std::endl;
+    uint32_t fourcc = fourccFromString(CAMERA_PIXEL_FORMAT);
+    if (CAMERA_BACKEND == "v4l2") {
+        source_ = std::make_unique<V4l2Capture>(CAMERA_DEVICE, CAMERA_CAPTURE_WIDTH, CAMERA_CAPTURE_HEIGHT,
+                                                fourcc, CAMERA_BUFFER_COUNT);
+    } else if (CAMERA_BACKEND == "file") {
+        source_ = std::make_unique<FileCapture>(CAMERA_FAKE_FILE, CAMERA_CAPTURE_WIDTH, CAMERA_CAPTURE_HEIGHT,
+                                                fourcc, CAMERA_BUFFER_COUNT, CAMERA_FPS);
+    } else {
+        source_ = std::make_unique<GstreamerCapture>();
+    }
+
+    if (!source_->open()) {
+        source_.reset();
         return false;
     }
 
-    std::cout << "[INFO] 카메라 초기화 성공" << std::endl;
+    std::cout << "[INFO] 카메라 초기화 성공 (" << source_->name() << ")" << std::endl;
     return true;
 }
 
-cv::Mat USBCam::getFrame() {
-    cv::Mat frame, resized;
-    cap >> frame;
-    if (frame.empty()) {
-        std::cerr << "[WARN] 프레임 읽기 실패" << std::endl;
-        return cv::Mat();
+bool USBCam::read(CapturedFrame& out, bool keep_bayer) {
+    // 이전 프레임 참조를 먼저 놓아야 백엔드가 그 버퍼를 재사용할 수 있음
+    out.hold.reset();
+    out.image.release();
+    if (!source_) return false;
+
+    CapturedFrame raw;
+    if (!source_->read(raw)) return false;
+
+    // Bayer 분류 경로: 디모자이크/축소는 전처리 단계의 쿼드 분류가 대신함
+    int red_x, red_y;
+    if (keep_bayer && bayerRedOffset(raw.fourcc, red_x, red_y)) {
+        out = raw;
+        return true;
+    }
+
+    const cv::Size target(FRAME_WIDTH, FRAME_HEIGHT);
+    bool is_bgr = (raw.fourcc == 0 || bytesPerPixel(raw.fourcc) == 3);
+    if (is_bgr && raw.image.size() == target) {
+        // 이미 주행 크기의 BGR: 드라이버 버퍼를 그대로 넘김 (복사 없음)
+        out = raw;
+        return true;
+    }
+
+    // 형식/크기 변환이 필요한 경우에만 새 프레임 생성, 원본 버퍼는 바로 반환
+    // 검출기가 읽는 출력 행에 해당하는 원본 행만 변환/축소
+    const int src_rows = raw.image.rows;
+    cv::Range rows = (crop_rows_ == cv::Range::all()) ? cv::Range(0, target.height)
+        : cv::Range(std::clamp(crop_rows_.start, 0, target.height), std::clamp(crop_rows_.end, 0, target.height));
+    int src_start = rows.start * src_rows / target.height;
+    int src_end = (rows.end * src_rows + target.height - 1) / target.height;
+    if (bayerRedOffset(raw.fourcc, red_x, red_y)) {
+        // Bayer 패턴 유지를 위해 짝수 행 경계로 맞춤
+        src_start &= ~1;
+        src_end = std::min(src_rows, (src_end + 1) & ~1);
+    }
+
+    cv::Mat resized(target, CV_8UC3);
+    if (rows.size() != target.height) resized.setTo(0);
+    if (!rows.empty()) {
+        CapturedFrame cropped = raw;
+        cropped.image = raw.image.rowRange(src_start, src_end);
+        cv::Mat bgr;
+        if (!convertToBgr(cropped, bgr)) {
+            std::cerr << "[ERROR] 변환할 수 없는 카메라 형식: " << fourccToString(raw.fourcc) << std::endl;
+            return false;
+        }
+        cv::Mat resized_rows = resized.rowRange(rows);
+        cv::resize(bgr, resized_rows, resized_rows.size());
     }
-    cv::resize(frame, resized, cv::Size(FRAME_WIDTH, FRAME_HEIGHT));
-    return resized;
+
+    out.image = resized;
+    out.fourcc = 0;
+    out.timestamp_ns = raw.timestamp_ns;
+    out.sequence = raw.sequence;
+    out.hold.reset();
+    return true;
+}
+
+void USBCam::setCropRows(cv::Range rows) {
+    crop_rows_ = rows;
+}
+
+const char* USBCam::backendName() const {
+    return source_ ? source_->name() : "none";
 }
@@ -0,0 +1,258 @@
+#include "v4l2_capture.hpp"
+#include "latency_stats.hpp"
+
+#include <iostream>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <linux/videodev2.h>
+
+namespace {
+constexpr int POLL_TIMEOUT_MS = 1000; // 프레임 대기 최대 시간
+constexpr int HELD_WAIT_MIN_US = 500;  // 버퍼 반환 대기 첫 간격
+constexpr int HELD_WAIT_MAX_US = 8000; // 버퍼 반환 대기 최대 간격
+constexpr int64_t HELD_WARN_INTERVAL_NS = 1000000000LL; // 버퍼 부족 경고 최소 간격
+
+// 시그널로 중단된 ioctl 재시도
+int xioctl(int fd, unsigned long request, void* arg) {
+    int r;
+    do {
+        r = ioctl(fd, request, arg);
+    } while (r == -1 && errno == EINTR);
+    return r;
+}
+}
+
+V4l2Capture::V4l2Capture(const std::string& device, int width, int height, uint32_t fourcc, int buffer_count)
+    : device_(device), width_(width), height_(height), fourcc_(fourcc), buffer_count_(buffer_count) {}
+
+V4l2Capture::~V4l2Capture() {
+    close();
+}
+
+bool V4l2Capture::open() {
+    if (bytesPerPixel(fourcc_) == 0) {
+        std::cerr << "[ERROR] 지원하지 않는 V4L2 픽셀 형식: " << fourccToString(fourcc_) << std::endl;
+        return false;
+    }
+
+    fd_ = ::open(device_.c_str(), O_RDWR | O_NONBLOCK);
+    if (fd_ < 0) {
+        std::cerr << "[ERROR] V4L2 장치 열기 실패: " << device_ << " (" << std::strerror(errno) << ")" << std::endl;
+        return false;
+    }
+
+    v4l2_capability cap{};
+    if (xioctl(fd_, VIDIOC_QUERYCAP, &cap) < 0) {
+        std::cerr << "[ERROR] VIDIOC_QUERYCAP 실패: " << std::strerror(errno) << std::endl;
+        close();
+        return false;
+    }
+    uint32_t caps = (cap.capabilities & V4L2_CAP_DEVICE_CAPS) ? cap.device_caps : cap.capabilities;
+    if (!(caps & V4L2_CAP_VIDEO_CAPTURE) || !(caps & V4L2_CAP_STREAMING)) {
+        std::cerr << "[ERROR] 스트리밍 캡처를 지원하지 않는 장치: " << device_ << std::endl;
+        close();
+        return false;
+    }
+
+    // 캡처 형식 설정 (드라이버가 가까운 크기로 바꿀 수 있으므로 결과 값 사용)
+    v4l2_format fmt{};
+    fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    fmt.fmt.pix.width = width_;
+    fmt.fmt.pix.height = height_;
+    fmt.fmt.pix.pixelformat = fourcc_;
+    fmt.fmt.pix.field = V4L2_FIELD_NONE;
+    if (xioctl(fd_, VIDIOC_S_FMT, &fmt) < 0 || fmt.fmt.pix.pixelformat != fourcc_) {
+        std::cerr << "[ERROR] V4L2 형식 설정 실패: " << fourccToString(fourcc_) << std::endl;
+        close();
+        return false;
+    }
+    width_ = fmt.fmt.pix.width;
+    height_ = fmt.fmt.pix.height;
+    stride_ = fmt.fmt.pix.bytesperline;
+
+    // mmap 버퍼 요청 및 매핑
+    v4l2_requestbuffers req{};
+    req.count = buffer_count_;
+    req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = V4L2_MEMORY_MMAP;
+    if (xioctl(fd_, VIDIOC_REQBUFS, &req) < 0 || req.count < 2) {
+        std::cerr << "[ERROR] V4L2 버퍼 요청 실패" << std::endl;
+        close();
+        return false;
+    }
+
+    buffers_.resize(req.count);
+    for (uint32_t i = 0; i < req.count; ++i) {
+        v4l2_buffer buf{};
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        buf.index = i;
+        if (xioctl(fd_, VIDIOC_QUERYBUF, &buf) < 0) {
+            std::cerr << "[ERROR] VIDIOC_QUERYBUF 실패" << std::endl;
+            close();
+            return false;
+        }
+        void* start = mmap(nullptr, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, buf.m.offset);
+        if (start == MAP_FAILED) {
+            std::cerr << "[ERROR] V4L2 버퍼 mmap 실패" << std::endl;
+            close();
+            return false;
+        }
+        buffers_[i].start = start;
+        buffers_[i].length = buf.length;
+        buffers_[i].token = std::make_shared<int>(static_cast<int>(i));
+    }
+
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        if (!queueBuffer(static_cast<int>(i))) {
+            close();
+            return false;
+        }
+    }
+
+    v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (xioctl(fd_, VIDIOC_STREAMON, &type) < 0) {
+        std::cerr << "[ERROR] VIDIOC_STREAMON 실패: " << std::strerror(errno) << std::endl;
+        close();
+        return false;
+    }
+    streaming_ = true;
+
+    std::cout << "[INFO] V4L2 캡처 시작: " << device_ << " " << width_ << "x" << height_
+              << " " << fourccToString(fourcc_) << ", 버퍼 " << buffers_.size() << "개" << std::endl;
+    return true;
+}
+
+bool V4l2Capture::queueBuffer(int index) {
+    v4l2_buffer buf{};
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    buf.index = index;
+    if (xioctl(fd_, VIDIOC_QBUF, &buf) < 0) {
+        std::cerr << "[ERROR] VIDIOC_QBUF 실패: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    buffers_[index].queued = true;
+    return true;
+}
+
+// 모든 버퍼를 하류가 들고 있으면 반환될 때까지 간격을 늘려 가며 대기 (최대 POLL_TIMEOUT_MS)
+// - 반환 알림이 없으므로 짧은 sleep 후 recycleBuffers 로 다시 확인
+bool V4l2Capture::waitForReleasedBuffer() {
+    const int64_t start_ns = monotonicNs();
+    int delay_us = HELD_WAIT_MIN_US;
+    while (true) {
+        recycleBuffers();
+        for (const Buffer& b : buffers_) {
+            if (b.queued) return true;
+        }
+        if (monotonicNs() - start_ns >= static_cast<int64_t>(POLL_TIMEOUT_MS) * 1000000LL) return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(delay_us));
+        delay_us = std::min(delay_us * 2, HELD_WAIT_MAX_US);
+    }
+}
+
+void V4l2Capture::recycleBuffers() {
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        Buffer& b = buffers_[i];
+        if (!b.queued && b.token.use_count() == 1) {
+            // 하류 스레드의 마지막 읽기가 끝난 뒤에 드라이버가 덮어쓰도록 순서 보장
+            std::atomic_thread_fence(std::memory_order_acquire);
+            queueBuffer(static_cast<int>(i));
+        }
+    }
+}
+
+bool V4l2Capture::read(CapturedFrame& out) {
+    // 호출자가 들고 있던 이전 프레임부터 놓아야 해당 버퍼를 다시 큐에 넣을 수 있음
+    out.hold.reset();
+    out.image.release();
+    if (fd_ < 0) return false;
+
+    recycleBuffers();
+    bool any_queued = false;
+    for (const Buffer& b : buffers_) any_queued |= b.queued;
+    if (!any_queued) {
+        // 하류가 버퍼를 놓을 때까지 대기 (바로 false 를 돌려주면 카메라 루프가 쉬지 않고 재시도함)
+        ++held_waits_;
+        const int64_t now_ns = monotonicNs();
+        if (now_ns - last_held_warn_ns_ >= HELD_WARN_INTERVAL_NS) {
+            std::cerr << "[WARN] 모든 V4L2 버퍼가 사용 중, 반환 대기 " << held_waits_
+                      << "회 (CAMERA_BUFFER_COUNT 를 늘리세요)" << std::endl;
+            last_held_warn_ns_ = now_ns;
+            held_waits_ = 0;
+        }
+        if (!waitForReleasedBuffer()) return false;
+    }
+
+    pollfd pfd{fd_, POLLIN, 0};
+    int r;
+    do {
+        r = poll(&pfd, 1, POLL_TIMEOUT_MS);
+    } while (r < 0 && errno == EINTR);
+    if (r <= 0) {
+        std::cerr << "[WARN] V4L2 프레임 대기 시간 초과" << std::endl;
+        return false;
+    }
+
+    // 큐에 쌓인 프레임을 모두 꺼내 가장 최신 것만 사용, 오래된 것은 바로 반환
+    int latest = -1;
+    v4l2_buffer latest_buf{};
+    while (true) {
+        v4l2_buffer buf{};
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        if (xioctl(fd_, VIDIOC_DQBUF, &buf) < 0) {
+            if (errno != EAGAIN) {
+                std::cerr << "[ERROR] VIDIOC_DQBUF 실패: " << std::strerror(errno) << std::endl;
+            }
+            break;
+        }
+        buffers_[buf.index].queued = false;
+        if (latest >= 0) queueBuffer(latest);
+        latest = static_cast<int>(buf.index);
+        latest_buf = buf;
+    }
+    if (latest < 0) return false;
+    if (latest_buf.flags & V4L2_BUF_FLAG_ERROR) {
+        queueBuffer(latest);
+        return false;
+    }
+
+    const int bpp = bytesPerPixel(fourcc_);
+    const int type = (bpp == 3) ? CV_8UC3 : (bpp == 2) ? CV_8UC2 : CV_8UC1;
+    Buffer& b = buffers_[latest];
+    out.image = cv::Mat(height_, width_, type, b.start, stride_);
+    out.fourcc = fourcc_;
+    bool monotonic = (latest_buf.flags & V4L2_BUF_FLAG_TIMESTAMP_MASK) == V4L2_BUF_FLAG_TIMESTAMP_MONOTONIC;
+    out.timestamp_ns = monotonic
+        ? static_cast<int64_t>(latest_buf.timestamp.tv_sec) * 1000000000LL + static_cast<int64_t>(latest_buf.timestamp.tv_usec) * 1000LL
+        : 0;
+    out.sequence = latest_buf.sequence;
+    out.hold = b.token;
+    return true;
+}
+
+void V4l2Capture::close() {
+    if (fd_ < 0) return;
+    if (streaming_) {
+        v4l2_buf_type type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        xioctl(fd_, VIDIOC_STREAMOFF, &type);
+        streaming_ = false;
+    }
+    for (Buffer& b : buffers_) {
+        if (b.start) munmap(b.start, b.length);
+    }
+    buffers_.clear();
+    ::close(fd_);
+    fd_ = -1;
+}
@@ -1,5 +1,7 @@
 // video_recorder.cpp
 #include "video_recorder.hpp"
+#include "thread_profile.hpp"
+#include <algorithm>
 #include <iostream>
 
 VideoRecorder::VideoRecorder() : initialized(false) {}
@@ -21,13 +23,64 @@ bool VideoRecorder::init(const std::string& filename, int width, int height, dou
     return true;
 }
 
+void VideoRecorder::startThread(int buffer_count) {
+    if (!initialized || thread_running_) return;
+    buffer_count = std::clamp(buffer_count, 1, static_cast<int>(QUEUE_SIZE) - 1);
+    buffers_.resize(buffer_count);
+    for (int i = 0; i < buffer_count; ++i) free_.push(i);
+    thread_running_ = true;
+    thread_ = std::thread(&VideoRecorder::threadLoop, this);
+}
+
 void VideoRecorder::write(const cv::Mat& frame) {
-    if (initialized) {
+    if (!initialized) return;
+    if (!thread_running_) {
         writer.write(frame);
+        return;
+    }
+
+    // 녹화 스레드가 인코딩 중인 버퍼는 건드리지 않고 빈 버퍼에만 복사
+    int index = -1;
+    if (!free_.pop(index)) {
+        ++dropped_;
+        return;
     }
+    frame.copyTo(buffers_[index]);
+    filled_.push(index);
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    wake_cv_.notify_one();
+}
+
+void VideoRecorder::threadLoop() {
+    applyThreadProfile("recorder");
+    PeriodJitter jitter;
+    int index = -1;
+    while (true) {
+        if (filled_.pop(index)) {
+            writer.write(buffers_[index]);
+            free_.push(index);
+            jitter.tick();
+            continue;
+        }
+        if (!thread_running_) break; // 남은 프레임까지 기록한 뒤 종료
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        wake_cv_.wait_for(lock, std::chrono::milliseconds(100), [&] {
+            return !filled_.empty() || !thread_running_;
+        });
+    }
+    jitter.report("recorder");
 }
 
 void VideoRecorder::release() {
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            thread_running_ = false;
+        }
+        wake_cv_.notify_one();
+        thread_.join();
+        if (dropped_ > 0) std::cout << "[WARN] 녹화 버퍼 부족으로 버린 프레임: " << dropped_ << std::endl;
+    }
     if (initialized) {
         writer.release();
         initialized = false;